@@ -1,4 +1,28 @@
 // The source code, authored by Zoxemik in 2025
 
 #include "Core/InputDataSetup.h"
+#include "Core/TopDownInputConfig.h"
 
+void UInputDataSetup::GetActionsToLoad(TArray<FSoftObjectPath>& OutPaths) const
+{
+	const TSoftObjectPtr<UInputAction> Actions[] =
+	{
+		MoveAction,
+		SpinAction,
+		ZoomAction,
+		SelectAction,
+		DragMoveAction,
+#if TOPDOWN_WITH_GAMEPAD
+		CursorAction,
+#endif
+		CommandAction
+	};
+
+	for (const TSoftObjectPtr<UInputAction>& Action : Actions)
+	{
+		if (!Action.IsNull())
+		{
+			OutPaths.Add(Action.ToSoftObjectPath());
+		}
+	}
+}
@@ -0,0 +1,294 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Core/TopDownCommandSubsystem.h"
+#include "TopDownMovement.h"
+#include "GameFramework/Actor.h"
+#include "Async/ParallelFor.h"
+#include "Algo/Sort.h"
+
+DECLARE_CYCLE_STAT(TEXT("Formation Assignment"), STAT_TopDownFormationAssignment, STATGROUP_TopDownMovement);
+
+namespace TopDownCommand
+{
+	struct FCandidate
+	{
+		float DistanceSquared;
+		int32 Unit;
+		int32 Slot;
+
+		bool operator<(const FCandidate& Other) const { return DistanceSquared < Other.DistanceSquared; }
+	};
+
+	/** Units per ParallelFor task, small groups stay on the game thread */
+	constexpr int32 UnitsPerTask = 64;
+
+	/** Passes of pairwise slot swaps between neighbours in formation order */
+	constexpr int32 MaxSwapPasses = 4;
+
+	/**
+	 * Orders the points like the formation rows: chunks of RowSize along Forward from the front, each chunk sorted along Right.
+	 * Ordering units and slots the same way and pairing them by rank keeps the rows from crossing when the group comes from afar.
+	 */
+	void SortInFormationOrder(TConstArrayView<FVector> Points, const FVector2D& Forward, const FVector2D& Right, int32 RowSize, TArray<int32>& OutOrder)
+	{
+		OutOrder.SetNumUninitialized(Points.Num());
+		for (int32 Index = 0; Index < Points.Num(); ++Index)
+		{
+			OutOrder[Index] = Index;
+		}
+
+		OutOrder.Sort([&](int32 A, int32 B) { return FVector2D::DotProduct(FVector2D(Points[A]), Forward) > FVector2D::DotProduct(FVector2D(Points[B]), Forward); });
+
+		for (int32 RowStart = 0; RowStart < OutOrder.Num(); RowStart += RowSize)
+		{
+			TArrayView<int32>(OutOrder.GetData() + RowStart, FMath::Min(RowSize, OutOrder.Num() - RowStart)).Sort([&](int32 A, int32 B)
+			{
+				return FVector2D::DotProduct(FVector2D(Points[A]), Right) < FVector2D::DotProduct(FVector2D(Points[B]), Right);
+			});
+		}
+	}
+
+	double GetTotalTravel(TConstArrayView<FVector> UnitLocations, TConstArrayView<FVector> Slots, const TArray<int32>& SlotIndices)
+	{
+		double TotalTravel = 0.0;
+		for (int32 UnitIndex = 0; UnitIndex < UnitLocations.Num(); ++UnitIndex)
+		{
+			TotalTravel += FVector::Dist2D(UnitLocations[UnitIndex], Slots[SlotIndices[UnitIndex]]);
+		}
+		return TotalTravel;
+	}
+}
+
+UTopDownCommandSubsystem::UTopDownCommandSubsystem()
+{
+	FormationSpacing = 150.0f;
+	CandidateSlots = 16;
+}
+
+void UTopDownCommandSubsystem::IssueMoveCommand(const TArray<AActor*>& Units, const FVector& Destination)
+{
+	// Null units get neither a slot nor a command, so they cannot pull the formation towards the destination
+	ScratchUnits.Reset(Units.Num());
+	ScratchUnitLocations.Reset(Units.Num());
+	FVector Centroid = FVector::ZeroVector;
+
+	for (AActor* Unit : Units)
+	{
+		if (!Unit) continue;
+
+		const FVector Location = Unit->GetActorLocation();
+		ScratchUnits.Add(Unit);
+		ScratchUnitLocations.Add(Location);
+		Centroid += Location;
+	}
+
+	if (ScratchUnitLocations.Num() == 0) return;
+
+	Centroid /= ScratchUnitLocations.Num();
+
+	GenerateFormationSlots(ScratchUnitLocations.Num(), Destination, Destination - Centroid, ScratchSlots);
+	AssignFormationSlots(ScratchUnitLocations, ScratchSlots, CandidateSlots, ScratchSlotIndices);
+
+	TArray<FTopDownMoveCommand> Commands;
+	Commands.Reserve(ScratchUnits.Num());
+
+	for (int32 UnitIndex = 0; UnitIndex < ScratchUnits.Num(); ++UnitIndex)
+	{
+		FTopDownMoveCommand& Command = Commands.AddDefaulted_GetRef();
+		Command.Unit = ScratchUnits[UnitIndex];
+		Command.Destination = ScratchSlots[ScratchSlotIndices[UnitIndex]];
+	}
+
+	OnMoveCommandsIssued.Broadcast(Commands);
+}
+
+void UTopDownCommandSubsystem::GenerateFormationSlots(int32 NumSlots, const FVector& Destination, const FVector& Facing, TArray<FVector>& OutSlots) const
+{
+	OutSlots.Reset(NumSlots);
+	if (NumSlots <= 0) return;
+
+	FVector Forward = FVector(Facing.X, Facing.Y, 0.0f).GetSafeNormal();
+	if (Forward.IsNearlyZero())
+	{
+		Forward = FVector::ForwardVector;
+	}
+	const FVector Right = FVector(-Forward.Y, Forward.X, 0.0f);
+
+	// Roughly square block, wider than deep when the count is not a square
+	const int32 Columns = FMath::CeilToInt32(FMath::Sqrt(static_cast<float>(NumSlots)));
+	const int32 Rows = FMath::DivideAndRoundUp(NumSlots, Columns);
+
+	for (int32 Row = 0; Row < Rows; ++Row)
+	{
+		// The last row may be partial, keep it centered
+		const int32 RowColumns = FMath::Min(Columns, NumSlots - Row * Columns);
+		const float RowOffset = ((Rows - 1) * 0.5f - Row) * FormationSpacing;
+
+		for (int32 Column = 0; Column < RowColumns; ++Column)
+		{
+			const float ColumnOffset = (Column - (RowColumns - 1) * 0.5f) * FormationSpacing;
+			OutSlots.Add(Destination + Forward * RowOffset + Right * ColumnOffset);
+		}
+	}
+}
+
+void UTopDownCommandSubsystem::AssignFormationSlots(TConstArrayView<FVector> UnitLocations, TConstArrayView<FVector> Slots, int32 InCandidateSlots, TArray<int32>& OutSlotIndices)
+{
+	SCOPE_CYCLE_COUNTER(STAT_TopDownFormationAssignment);
+
+	using TopDownCommand::FCandidate;
+
+	const int32 NumUnits = UnitLocations.Num();
+	const int32 NumSlots = Slots.Num();
+	check(NumSlots >= NumUnits);
+
+	OutSlotIndices.Init(INDEX_NONE, NumUnits);
+	if (NumUnits == 0) return;
+
+	// Units and slots of the current round, units whose candidates were all taken by closer units go to the next one
+	TArray<int32> PendingUnits;
+	PendingUnits.SetNumUninitialized(NumUnits);
+	for (int32 UnitIndex = 0; UnitIndex < NumUnits; ++UnitIndex)
+	{
+		PendingUnits[UnitIndex] = UnitIndex;
+	}
+
+	TArray<int32> FreeSlots;
+	FreeSlots.SetNumUninitialized(NumSlots);
+	for (int32 SlotIndex = 0; SlotIndex < NumSlots; ++SlotIndex)
+	{
+		FreeSlots[SlotIndex] = SlotIndex;
+	}
+
+	TArray<FCandidate> Candidates;
+	TBitArray<> SlotTaken(false, NumSlots);
+
+	// Every round assigns at least its shortest pair, and usually most of the units
+	while (PendingUnits.Num() > 0)
+	{
+		const int32 NumCandidates = FMath::Clamp(InCandidateSlots, 1, FreeSlots.Num());
+
+		// K nearest free slots of every pending unit, each unit writes its own range so no synchronization is needed
+		Candidates.SetNumUninitialized(PendingUnits.Num() * NumCandidates, EAllowShrinking::No);
+
+		ParallelFor(TEXT("TopDownFormationCandidates"), PendingUnits.Num(), TopDownCommand::UnitsPerTask, [&](int32 PendingIndex)
+		{
+			FCandidate* UnitCandidates = Candidates.GetData() + PendingIndex * NumCandidates;
+			int32 NumFound = 0;
+
+			const int32 UnitIndex = PendingUnits[PendingIndex];
+			const FVector2D UnitLocation(UnitLocations[UnitIndex]);
+
+			for (const int32 SlotIndex : FreeSlots)
+			{
+				const float DistanceSquared = FVector2D::DistSquared(UnitLocation, FVector2D(Slots[SlotIndex]));
+				if (NumFound == NumCandidates && DistanceSquared >= UnitCandidates[NumFound - 1].DistanceSquared) continue;
+
+				// Insertion into the sorted candidate list, dropping the furthest when full
+				int32 InsertIndex = NumFound < NumCandidates ? NumFound++ : NumFound - 1;
+				while (InsertIndex > 0 && UnitCandidates[InsertIndex - 1].DistanceSquared > DistanceSquared)
+				{
+					UnitCandidates[InsertIndex] = UnitCandidates[InsertIndex - 1];
+					--InsertIndex;
+				}
+				UnitCandidates[InsertIndex] = { DistanceSquared, UnitIndex, SlotIndex };
+			}
+		});
+
+		Algo::Sort(Candidates);
+
+		for (const FCandidate& Candidate : Candidates)
+		{
+			if (OutSlotIndices[Candidate.Unit] != INDEX_NONE || SlotTaken[Candidate.Slot]) continue;
+
+			OutSlotIndices[Candidate.Unit] = Candidate.Slot;
+			SlotTaken[Candidate.Slot] = true;
+		}
+
+		PendingUnits.RemoveAll([&OutSlotIndices](int32 UnitIndex) { return OutSlotIndices[UnitIndex] != INDEX_NONE; });
+		FreeSlots.RemoveAll([&SlotTaken](int32 SlotIndex) { return SlotTaken[SlotIndex]; });
+	}
+
+	// Nearest first wins for groups already close to their slots, but crosses rows when the group comes from afar.
+	// The formation order assignment, pairing units and slots by rank from the front row, is kept instead when it travels less
+	if (NumSlots != NumUnits) return;
+
+	FVector2D UnitCentroid = FVector2D::ZeroVector;
+	FVector2D SlotCentroid = FVector2D::ZeroVector;
+	for (int32 Index = 0; Index < NumUnits; ++Index)
+	{
+		UnitCentroid += FVector2D(UnitLocations[Index]);
+		SlotCentroid += FVector2D(Slots[Index]);
+	}
+
+	FVector2D Forward = (SlotCentroid - UnitCentroid).GetSafeNormal();
+	if (Forward.IsNearlyZero())
+	{
+		Forward = FVector2D(1.0f, 0.0f);
+	}
+	const FVector2D Right(-Forward.Y, Forward.X);
+	const int32 RowSize = FMath::CeilToInt32(FMath::Sqrt(static_cast<float>(NumUnits)));
+
+	TArray<int32> UnitOrder;
+	TArray<int32> SlotOrder;
+	TopDownCommand::SortInFormationOrder(UnitLocations, Forward, Right, RowSize, UnitOrder);
+	TopDownCommand::SortInFormationOrder(Slots, Forward, Right, RowSize, SlotOrder);
+
+	TArray<int32> RankSlotIndices;
+	RankSlotIndices.SetNumUninitialized(NumUnits);
+	for (int32 Rank = 0; Rank < NumUnits; ++Rank)
+	{
+		RankSlotIndices[UnitOrder[Rank]] = SlotOrder[Rank];
+	}
+
+	if (TopDownCommand::GetTotalTravel(UnitLocations, Slots, RankSlotIndices) < TopDownCommand::GetTotalTravel(UnitLocations, Slots, OutSlotIndices))
+	{
+		OutSlotIndices = MoveTemp(RankSlotIndices);
+	}
+
+	// Swap slots with the units holding the neighbouring slots in formation order whenever it shortens the travel of both
+	TArray<int32> SlotRanks;
+	TArray<int32> SlotUnits;
+	SlotRanks.SetNumUninitialized(NumSlots);
+	SlotUnits.SetNumUninitialized(NumSlots);
+	for (int32 Rank = 0; Rank < NumSlots; ++Rank)
+	{
+		SlotRanks[SlotOrder[Rank]] = Rank;
+	}
+	for (int32 UnitIndex = 0; UnitIndex < NumUnits; ++UnitIndex)
+	{
+		SlotUnits[OutSlotIndices[UnitIndex]] = UnitIndex;
+	}
+
+	const int32 NeighbourOffsets[] = { -RowSize - 1, -RowSize, -RowSize + 1, -1, 1, RowSize - 1, RowSize, RowSize + 1 };
+
+	for (int32 Pass = 0; Pass < TopDownCommand::MaxSwapPasses; ++Pass)
+	{
+		int32 NumSwaps = 0;
+
+		for (int32 UnitIndex = 0; UnitIndex < NumUnits; ++UnitIndex)
+		{
+			for (const int32 Offset : NeighbourOffsets)
+			{
+				const int32 UnitSlot = OutSlotIndices[UnitIndex];
+				const int32 NeighbourRank = SlotRanks[UnitSlot] + Offset;
+				if (NeighbourRank < 0 || NeighbourRank >= NumSlots) continue;
+
+				const int32 OtherSlot = SlotOrder[NeighbourRank];
+				const int32 OtherUnit = SlotUnits[OtherSlot];
+
+				const double CurrentTravel = FVector::Dist2D(UnitLocations[UnitIndex], Slots[UnitSlot]) + FVector::Dist2D(UnitLocations[OtherUnit], Slots[OtherSlot]);
+				const double SwappedTravel = FVector::Dist2D(UnitLocations[UnitIndex], Slots[OtherSlot]) + FVector::Dist2D(UnitLocations[OtherUnit], Slots[UnitSlot]);
+				if (SwappedTravel >= CurrentTravel - UE_KINDA_SMALL_NUMBER) continue;
+
+				OutSlotIndices[UnitIndex] = OtherSlot;
+				OutSlotIndices[OtherUnit] = UnitSlot;
+				SlotUnits[OtherSlot] = UnitIndex;
+				SlotUnits[UnitSlot] = OtherUnit;
+				++NumSwaps;
+			}
+		}
+
+		if (NumSwaps == 0) break;
+	}
+}
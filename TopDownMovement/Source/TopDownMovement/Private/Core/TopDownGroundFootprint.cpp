@@ -0,0 +1,94 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Core/TopDownGroundFootprint.h"
+
+void FTopDownGroundFootprint::Finalize()
+{
+	Bounds = FBox2D(ForceInit);
+	Center = FVector::ZeroVector;
+
+	for (const FVector& Corner : Corners)
+	{
+		Bounds += FVector2D(Corner);
+		Center += Corner * 0.25f;
+	}
+}
+
+float FTopDownGroundFootprint::GetRadius() const
+{
+	float RadiusSquared = 0.0f;
+	for (const FVector& Corner : Corners)
+	{
+		RadiusSquared = FMath::Max(RadiusSquared, FVector::DistSquared2D(Corner, Center));
+	}
+	return FMath::Sqrt(RadiusSquared);
+}
+
+bool FTopDownGroundFootprint::ContainsPoint(const FVector2D& Point) const
+{
+	if (!bIsValid || !Bounds.IsInside(Point)) return false;
+
+	// The quad is convex, the point has to be on the same side of every edge
+	bool bHasPositive = false;
+	bool bHasNegative = false;
+	for (int32 Index = 0; Index < 4; ++Index)
+	{
+		const FVector2D EdgeStart(Corners[Index]);
+		const FVector2D EdgeEnd(Corners[(Index + 1) % 4]);
+		const float Cross = FVector2D::CrossProduct(EdgeEnd - EdgeStart, Point - EdgeStart);
+
+		bHasPositive |= Cross > 0.0f;
+		bHasNegative |= Cross < 0.0f;
+	}
+
+	return !(bHasPositive && bHasNegative);
+}
+
+bool FTopDownGroundFootprint::IntersectsBox(const FBox2D& Box) const
+{
+	// Separating axis test, the box axes are covered by the bounds check
+	if (!bIsValid || !Bounds.Intersect(Box)) return false;
+
+	const FVector2D BoxCorners[4] = {
+		Box.Min,
+		FVector2D(Box.Max.X, Box.Min.Y),
+		Box.Max,
+		FVector2D(Box.Min.X, Box.Max.Y)
+	};
+
+	for (int32 Index = 0; Index < 4; ++Index)
+	{
+		const FVector2D EdgeStart(Corners[Index]);
+		const FVector2D EdgeEnd(Corners[(Index + 1) % 4]);
+		const FVector2D Axis(-(EdgeEnd.Y - EdgeStart.Y), EdgeEnd.X - EdgeStart.X);
+
+		float QuadMin = TNumericLimits<float>::Max();
+		float QuadMax = TNumericLimits<float>::Lowest();
+		float BoxMin = TNumericLimits<float>::Max();
+		float BoxMax = TNumericLimits<float>::Lowest();
+
+		for (int32 CornerIndex = 0; CornerIndex < 4; ++CornerIndex)
+		{
+			const float QuadProjection = FVector2D::DotProduct(FVector2D(Corners[CornerIndex]), Axis);
+			QuadMin = FMath::Min(QuadMin, QuadProjection);
+			QuadMax = FMath::Max(QuadMax, QuadProjection);
+
+			const float BoxProjection = FVector2D::DotProduct(BoxCorners[CornerIndex], Axis);
+			BoxMin = FMath::Min(BoxMin, BoxProjection);
+			BoxMax = FMath::Max(BoxMax, BoxProjection);
+		}
+
+		if (BoxMax < QuadMin || BoxMin > QuadMax) return false;
+	}
+
+	return true;
+}
+
+bool FTopDownGroundFootprint::ContainsBox(const FBox2D& Box) const
+{
+	// The quad is convex, so it contains the box when it contains all four corners
+	return ContainsPoint(Box.Min)
+		&& ContainsPoint(Box.Max)
+		&& ContainsPoint(FVector2D(Box.Min.X, Box.Max.Y))
+		&& ContainsPoint(FVector2D(Box.Max.X, Box.Min.Y));
+}
@@ -0,0 +1,128 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Core/TopDownGroupTracker.h"
+#include "Algo/BinarySearch.h"
+
+void FTopDownGroupTracker::FAxisCounts::Add(int32 Bin)
+{
+	const int32 Index = Algo::LowerBoundBy(Bins, Bin, &FBinCount::Bin);
+	if (Bins.IsValidIndex(Index) && Bins[Index].Bin == Bin)
+	{
+		++Bins[Index].Count;
+		return;
+	}
+
+	Bins.Insert({ Bin, 1 }, Index);
+}
+
+void FTopDownGroupTracker::FAxisCounts::Remove(int32 Bin)
+{
+	const int32 Index = Algo::LowerBoundBy(Bins, Bin, &FBinCount::Bin);
+	if (!Bins.IsValidIndex(Index) || Bins[Index].Bin != Bin) return;
+
+	// Emptied bins are dropped, so the extremes never need a walk over empty bins
+	if (--Bins[Index].Count == 0)
+	{
+		Bins.RemoveAt(Index, 1, EAllowShrinking::No);
+	}
+}
+
+FTopDownGroupTracker::FTopDownGroupTracker(float InBinSize)
+	: BinSize(FMath::Max(InBinSize, 1.0f))
+	, InvBinSize(1.0f / BinSize)
+	, SumX(0.0)
+	, SumY(0.0)
+{
+}
+
+FIntPoint FTopDownGroupTracker::GetBin(const FVector2D& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X * InvBinSize), FMath::FloorToInt32(Location.Y * InvBinSize));
+}
+
+void FTopDownGroupTracker::Add(const AActor* Actor, const FVector& Location)
+{
+	if (!Actor || Members.Contains(Actor)) return;
+
+	const FVector2D GroundLocation(Location);
+	Members.Add(Actor, GroundLocation);
+
+	SumX += GroundLocation.X;
+	SumY += GroundLocation.Y;
+
+	const FIntPoint Bin = GetBin(GroundLocation);
+	Columns.Add(Bin.X);
+	Rows.Add(Bin.Y);
+}
+
+void FTopDownGroupTracker::Remove(const AActor* Actor)
+{
+	FVector2D GroundLocation;
+	if (!Members.RemoveAndCopyValue(Actor, GroundLocation)) return;
+
+	SumX -= GroundLocation.X;
+	SumY -= GroundLocation.Y;
+
+	const FIntPoint Bin = GetBin(GroundLocation);
+	Columns.Remove(Bin.X);
+	Rows.Remove(Bin.Y);
+
+	if (Members.Num() == 0)
+	{
+		SumX = 0.0;
+		SumY = 0.0;
+	}
+}
+
+void FTopDownGroupTracker::Move(const AActor* Actor, const FVector& NewLocation)
+{
+	FVector2D* GroundLocation = Members.Find(Actor);
+	if (!GroundLocation) return;
+
+	const FVector2D NewGroundLocation(NewLocation);
+
+	SumX += NewGroundLocation.X - GroundLocation->X;
+	SumY += NewGroundLocation.Y - GroundLocation->Y;
+
+	const FIntPoint OldBin = GetBin(*GroundLocation);
+	const FIntPoint NewBin = GetBin(NewGroundLocation);
+
+	if (OldBin.X != NewBin.X)
+	{
+		Columns.Add(NewBin.X);
+		Columns.Remove(OldBin.X);
+	}
+	if (OldBin.Y != NewBin.Y)
+	{
+		Rows.Add(NewBin.Y);
+		Rows.Remove(OldBin.Y);
+	}
+
+	*GroundLocation = NewGroundLocation;
+}
+
+void FTopDownGroupTracker::Reset()
+{
+	Members.Reset();
+	SumX = 0.0;
+	SumY = 0.0;
+	Columns.Reset();
+	Rows.Reset();
+}
+
+FVector2D FTopDownGroupTracker::GetCentroid() const
+{
+	if (Members.Num() == 0) return FVector2D::ZeroVector;
+
+	return FVector2D(SumX / Members.Num(), SumY / Members.Num());
+}
+
+FBox2D FTopDownGroupTracker::GetBounds() const
+{
+	if (Members.Num() == 0) return FBox2D(ForceInit);
+
+	return FBox2D(
+		FVector2D(Columns.GetMin() * BinSize, Rows.GetMin() * BinSize),
+		FVector2D((Columns.GetMax() + 1) * BinSize, (Rows.GetMax() + 1) * BinSize)
+	);
+}
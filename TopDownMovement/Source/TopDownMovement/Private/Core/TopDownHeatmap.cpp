@@ -0,0 +1,209 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Core/TopDownHeatmap.h"
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+
+namespace TopDownHeatmap
+{
+	constexpr int32 NumLayers = static_cast<int32>(ETopDownHeatmapLayer::Num);
+
+	/** Keeps the counters from wrapping on very long sessions or large merges */
+	FORCEINLINE void SaturatingAdd(uint32& Counter, uint32 Amount)
+	{
+		Counter = Amount > MAX_uint32 - Counter ? MAX_uint32 : Counter + Amount;
+	}
+}
+
+FTopDownHeatmap::FTopDownHeatmap()
+	: Bounds(ForceInit)
+	, Resolution(0, 0)
+	, InvCellSize(FVector2D::ZeroVector)
+{
+}
+
+void FTopDownHeatmap::Init(const FBox2D& InBounds, const FIntPoint& InResolution)
+{
+	Bounds = InBounds;
+	Resolution = FIntPoint(FMath::Max(InResolution.X, 1), FMath::Max(InResolution.Y, 1));
+
+	const FVector2D Size = Bounds.GetSize();
+	InvCellSize = FVector2D(
+		Size.X > UE_SMALL_NUMBER ? Resolution.X / Size.X : 0.0f,
+		Size.Y > UE_SMALL_NUMBER ? Resolution.Y / Size.Y : 0.0f
+	);
+
+	Counters.SetNumZeroed(Resolution.X * Resolution.Y * TopDownHeatmap::NumLayers);
+}
+
+FIntPoint FTopDownHeatmap::GetCell(const FVector& Location) const
+{
+	const int32 CellX = FMath::FloorToInt32((Location.X - Bounds.Min.X) * InvCellSize.X);
+	const int32 CellY = FMath::FloorToInt32((Location.Y - Bounds.Min.Y) * InvCellSize.Y);
+
+	if (CellX < 0 || CellY < 0 || CellX >= Resolution.X || CellY >= Resolution.Y)
+	{
+		return FIntPoint(-1, -1);
+	}
+	return FIntPoint(CellX, CellY);
+}
+
+void FTopDownHeatmap::Increment(ETopDownHeatmapLayer Layer, const FVector& Location, uint32 Amount)
+{
+	if (!IsInitialized()) return;
+
+	const FIntPoint Cell = GetCell(Location);
+	if (Cell.X < 0) return;
+
+	TopDownHeatmap::SaturatingAdd(Counters[GetCounterIndex(Layer, Cell)], Amount);
+}
+
+void FTopDownHeatmap::RecordZoom(const FVector& Location, float ZoomValue)
+{
+	Increment(ETopDownHeatmapLayer::ZoomSamples, Location, 1);
+	Increment(ETopDownHeatmapLayer::ZoomSum, Location, static_cast<uint32>(FMath::RoundToInt32(FMath::Clamp(ZoomValue, 0.0f, 1.0f) * 255.0f)));
+}
+
+uint32 FTopDownHeatmap::GetCounter(ETopDownHeatmapLayer Layer, const FIntPoint& Cell) const
+{
+	if (!IsInitialized() || Cell.X < 0 || Cell.Y < 0 || Cell.X >= Resolution.X || Cell.Y >= Resolution.Y) return 0;
+
+	return Counters[GetCounterIndex(Layer, Cell)];
+}
+
+float FTopDownHeatmap::GetAverageZoom(const FIntPoint& Cell) const
+{
+	const uint32 Samples = GetCounter(ETopDownHeatmapLayer::ZoomSamples, Cell);
+	if (Samples == 0) return -1.0f;
+
+	return static_cast<float>(GetCounter(ETopDownHeatmapLayer::ZoomSum, Cell)) / (Samples * 255.0f);
+}
+
+void FTopDownHeatmap::CopyFrom(const FTopDownHeatmap& Other)
+{
+	Bounds = Other.Bounds;
+	Resolution = Other.Resolution;
+	InvCellSize = Other.InvCellSize;
+
+	// Assignment reuses the existing allocation when the sizes match
+	Counters = Other.Counters;
+}
+
+bool FTopDownHeatmap::Merge(const FTopDownHeatmap& Other)
+{
+	if (!IsInitialized())
+	{
+		CopyFrom(Other);
+		return true;
+	}
+
+	if (Other.Resolution != Resolution || !Other.Bounds.Min.Equals(Bounds.Min) || !Other.Bounds.Max.Equals(Bounds.Max))
+	{
+		return false;
+	}
+
+	for (int32 Index = 0; Index < Counters.Num(); ++Index)
+	{
+		TopDownHeatmap::SaturatingAdd(Counters[Index], Other.Counters[Index]);
+	}
+	return true;
+}
+
+void FTopDownHeatmap::Reset()
+{
+	FMemory::Memzero(Counters.GetData(), Counters.NumBytes());
+}
+
+bool FTopDownHeatmap::SaveToFile(const FString& Filename) const
+{
+	if (!IsInitialized()) return false;
+
+	TArray<uint8> Bytes;
+	Bytes.Reserve(64 + Counters.NumBytes());
+
+	FMemoryWriter Writer(Bytes);
+
+	uint32 Magic = FileMagic;
+	uint32 Version = FileVersion;
+	int32 NumLayers = TopDownHeatmap::NumLayers;
+	FVector2D BoundsMin = Bounds.Min;
+	FVector2D BoundsMax = Bounds.Max;
+	FIntPoint FileResolution = Resolution;
+
+	Writer << Magic << Version << FileResolution << BoundsMin << BoundsMax << NumLayers;
+	Writer.Serialize(const_cast<uint32*>(Counters.GetData()), Counters.NumBytes());
+
+	// Written next to the destination and moved over it, so a crash mid write never leaves a truncated session behind
+	const FString TempFilename = Filename + TEXT(".tmp");
+	if (!FFileHelper::SaveArrayToFile(Bytes, *TempFilename))
+	{
+		IFileManager::Get().Delete(*TempFilename, false, false, true);
+		return false;
+	}
+
+	if (!IFileManager::Get().Move(*Filename, *TempFilename, true))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Heatmap %s could not be moved into place"), *Filename);
+		IFileManager::Get().Delete(*TempFilename, false, false, true);
+		return false;
+	}
+
+	return true;
+}
+
+bool FTopDownHeatmap::LoadFromFile(const FString& Filename)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Filename, FILEREAD_Silent)) return false;
+
+	FMemoryReader Reader(Bytes);
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	Reader << Magic << Version;
+	if (Magic != FileMagic || Version != FileVersion)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Heatmap %s has an unknown format (magic %08x, version %u)"), *Filename, Magic, Version);
+		return false;
+	}
+
+	int32 NumLayers = 0;
+	FVector2D BoundsMin, BoundsMax;
+	FIntPoint FileResolution;
+	Reader << FileResolution << BoundsMin << BoundsMax << NumLayers;
+
+	const int64 ExpectedBytes = static_cast<int64>(FileResolution.X) * FileResolution.Y * NumLayers * sizeof(uint32);
+	if (Reader.IsError() || NumLayers != TopDownHeatmap::NumLayers || FileResolution.X <= 0 || FileResolution.Y <= 0 || Reader.TotalSize() - Reader.Tell() != ExpectedBytes)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Heatmap %s is truncated or corrupted"), *Filename);
+		return false;
+	}
+
+	Init(FBox2D(BoundsMin, BoundsMax), FileResolution);
+	Reader.Serialize(Counters.GetData(), Counters.NumBytes());
+
+	return !Reader.IsError();
+}
+
+int32 FTopDownHeatmap::LoadAndMerge(const TArray<FString>& Filenames, FTopDownHeatmap& OutHeatmap)
+{
+	int32 NumMerged = 0;
+	FTopDownHeatmap Session;
+
+	for (const FString& Filename : Filenames)
+	{
+		if (!Session.LoadFromFile(Filename)) continue;
+
+		if (!OutHeatmap.Merge(Session))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Heatmap %s skipped, its bounds or resolution differ from the merged sessions"), *Filename);
+			continue;
+		}
+
+		++NumMerged;
+	}
+
+	return NumMerged;
+}
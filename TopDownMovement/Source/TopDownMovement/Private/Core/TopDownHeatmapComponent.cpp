@@ -0,0 +1,161 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Core/TopDownHeatmapComponent.h"
+#include "Core/TopDownPlayer.h"
+#include "TopDownMovement.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Heatmap Sample"), STAT_TopDownHeatmapSample, STATGROUP_TopDownMovement);
+
+UTopDownHeatmapComponent::UTopDownHeatmapComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+
+	HeatmapBounds = FBox2D(FVector2D(-100000.0f), FVector2D(100000.0f));
+	HeatmapResolution = FIntPoint(256, 256);
+	SampleInterval = 0.2f;
+	FlushInterval = 60.0f;
+	OutputDirectory = TEXT("Telemetry/Heatmaps");
+
+	TimeSinceFlush = 0.0f;
+}
+
+void UTopDownHeatmapComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	Player = Cast<ATopDownPlayer>(GetOwner());
+	if (!Player) { UE_LOG(LogTemp, Warning, TEXT("TopDownHeatmapComponent requires an ATopDownPlayer owner")) SetComponentTickEnabled(false); return; }
+
+	// The pawn is usually possessed after BeginPlay, and on clients the controller replicates in later
+	Player->ReceiveControllerChangedDelegate.AddDynamic(this, &UTopDownHeatmapComponent::OnOwnerControllerChanged);
+
+	UpdateRecording();
+}
+
+void UTopDownHeatmapComponent::UpdateRecording()
+{
+	// Only the local player's view is meaningful, servers and simulated proxies do not record
+	if (!Player->IsLocallyControlled())
+	{
+		if (IsComponentTickEnabled())
+		{
+			SetComponentTickEnabled(false);
+			Flush();
+		}
+		return;
+	}
+
+	if (!Heatmap.IsInitialized())
+	{
+		Heatmap.Init(HeatmapBounds, HeatmapResolution);
+		FlushSnapshot = MakeShared<FTopDownHeatmap, ESPMode::ThreadSafe>();
+		FlushSnapshot->Init(HeatmapBounds, HeatmapResolution);
+
+		SessionFilename = FPaths::Combine(FPaths::ProjectSavedDir(), OutputDirectory, FString::Printf(TEXT("%s_%s.tdheat"), *FDateTime::UtcNow().ToString(), *GetOwner()->GetName()));
+	}
+
+	SetComponentTickInterval(SampleInterval);
+	SetComponentTickEnabled(true);
+}
+
+void UTopDownHeatmapComponent::OnOwnerControllerChanged(APawn* Pawn, AController* OldController, AController* NewController)
+{
+	UpdateRecording();
+}
+
+void UTopDownHeatmapComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (Player)
+	{
+		Player->ReceiveControllerChangedDelegate.RemoveDynamic(this, &UTopDownHeatmapComponent::OnOwnerControllerChanged);
+	}
+
+	if (Heatmap.IsInitialized())
+	{
+		// Flush skips while a periodic flush is still running, wait for it so the final counters are always written
+		FlushTask.Wait();
+		Flush();
+		FlushTask.Wait();
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UTopDownHeatmapComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	Sample();
+
+	TimeSinceFlush += DeltaTime;
+	if (TimeSinceFlush >= FlushInterval)
+	{
+		Flush();
+	}
+}
+
+void UTopDownHeatmapComponent::Sample()
+{
+	SCOPE_CYCLE_COUNTER(STAT_TopDownHeatmapSample);
+
+	const FVector TargetHandle = Player->GetTargetHandle();
+	Heatmap.RecordTargetHandle(TargetHandle);
+	Heatmap.RecordZoom(Player->GetGroundFootprint().bIsValid ? Player->GetGroundFootprint().Center : TargetHandle, Player->GetZoomValue());
+
+	if (Player->IsHoveringSelectable())
+	{
+		Heatmap.RecordHover(Player->GetCursorLocation());
+	}
+}
+
+void UTopDownHeatmapComponent::Flush()
+{
+	if (!Heatmap.IsInitialized() || !FlushTask.IsCompleted()) return;
+
+	TimeSinceFlush = 0.0f;
+
+	// The previous task is done, so the snapshot is only referenced here and can be overwritten in place
+	FlushSnapshot->CopyFrom(Heatmap);
+
+	FlushTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Snapshot = FlushSnapshot, Filename = SessionFilename]()
+	{
+		if (!Snapshot->SaveToFile(Filename))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Failed to write heatmap %s"), *Filename);
+		}
+	}, UE::Tasks::ETaskPriority::BackgroundLow);
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommand CmdMergeHeatmaps(
+	TEXT("TopDown.MergeHeatmaps"),
+	TEXT("Merges every .tdheat file of a directory into one file. Usage: TopDown.MergeHeatmaps <Directory> <OutputFile>"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		if (Args.Num() < 2) { UE_LOG(LogTemp, Warning, TEXT("Usage: TopDown.MergeHeatmaps <Directory> <OutputFile>")) return; }
+
+		TArray<FString> Filenames;
+		IFileManager::Get().FindFiles(Filenames, *FPaths::Combine(Args[0], TEXT("*.tdheat")), true, false);
+		for (FString& Filename : Filenames)
+		{
+			Filename = FPaths::Combine(Args[0], Filename);
+		}
+
+		FTopDownHeatmap Merged;
+		const int32 NumMerged = FTopDownHeatmap::LoadAndMerge(Filenames, Merged);
+
+		if (NumMerged > 0 && Merged.SaveToFile(Args[1]))
+		{
+			UE_LOG(LogTemp, Log, TEXT("Merged %d of %d heatmaps into %s"), NumMerged, Filenames.Num(), *Args[1]);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("No heatmap merged from %s"), *Args[0]);
+		}
+	})
+);
+#endif
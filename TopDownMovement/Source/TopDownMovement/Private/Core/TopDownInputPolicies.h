@@ -0,0 +1,92 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/TopDownController.h"
+#include "Core/TopDownInputConfig.h"
+#include "Core/TopDownInputSource.h"
+#include "Core/TopDownPlayer.h"
+
+/**
+ * Input policies - Per-device behavior used to specialize the ATopDownPlayer update routines at compile time.
+ *
+ * GetPointerPosition: Writes the screen position driving the cursor, only querying the policy's own device from the player's input source.
+ *                     The gamepad uses the virtual cursor moved by the right stick.
+ *                     Falls back to the viewport center and returns false when the device has no valid position.
+ * EdgeMoveScale: Multiplier applied to EdgeMoveDistance for the edge scrolling margin.
+ * GroundOffset: Vertical offset applied to the ground plane intersection.
+ * bIsTouch: Whether the cursor and collision sphere follow the touch rules (snap to the finger, hide when released).
+ */
+
+/** Used until the controller reports an input type, and for devices compiled out of the build. */
+struct FTopDownNoInputPolicy
+{
+	static constexpr EInputType InputType = EInputType::Unknown;
+	static constexpr float EdgeMoveScale = 0.0f;
+	static constexpr float GroundOffset = 0.0f;
+	static constexpr bool bIsTouch = false;
+
+	static FORCEINLINE bool GetPointerPosition(const ATopDownPlayer& Player, const UTopDownInputSource& InputSource, const FVector2D& ViewportCenter, FVector2D& OutScreenPos)
+	{
+		OutScreenPos = ViewportCenter;
+		return false;
+	}
+};
+
+#if TOPDOWN_WITH_MOUSE
+struct FTopDownMouseInputPolicy
+{
+	static constexpr EInputType InputType = EInputType::KeyMouse;
+	static constexpr float EdgeMoveScale = 1.0f;
+	static constexpr float GroundOffset = 0.0f;
+	static constexpr bool bIsTouch = false;
+
+	static FORCEINLINE bool GetPointerPosition(const ATopDownPlayer& Player, const UTopDownInputSource& InputSource, const FVector2D& ViewportCenter, FVector2D& OutScreenPos)
+	{
+		if (InputSource.GetMousePosition(OutScreenPos))
+		{
+			return true;
+		}
+
+		OutScreenPos = ViewportCenter;
+		return false;
+	}
+};
+#endif
+
+#if TOPDOWN_WITH_TOUCH
+struct FTopDownTouchInputPolicy
+{
+	static constexpr EInputType InputType = EInputType::Touch;
+	static constexpr float EdgeMoveScale = 2.0f;
+	static constexpr float GroundOffset = -500.0f;
+	static constexpr bool bIsTouch = true;
+
+	static FORCEINLINE bool GetPointerPosition(const ATopDownPlayer& Player, const UTopDownInputSource& InputSource, const FVector2D& ViewportCenter, FVector2D& OutScreenPos)
+	{
+		FVector2D TouchPosition;
+		const bool bIsCurrentlyPressed = InputSource.GetTouchState(ETouchIndex::Touch1, TouchPosition);
+
+		OutScreenPos = bIsCurrentlyPressed ? TouchPosition : ViewportCenter;
+		return bIsCurrentlyPressed;
+	}
+};
+#endif
+
+#if TOPDOWN_WITH_GAMEPAD
+struct FTopDownGamepadInputPolicy
+{
+	static constexpr EInputType InputType = EInputType::Gamepad;
+	static constexpr float EdgeMoveScale = 2.0f;
+	static constexpr float GroundOffset = 0.0f;
+	static constexpr bool bIsTouch = false;
+
+	static FORCEINLINE bool GetPointerPosition(const ATopDownPlayer& Player, const UTopDownInputSource& InputSource, const FVector2D& ViewportCenter, FVector2D& OutScreenPos)
+	{
+		const FVector2D VirtualCursorPosition = Player.GetVirtualCursorPosition();
+		OutScreenPos = VirtualCursorPosition.X >= 0.0f ? VirtualCursorPosition : ViewportCenter;
+		return true;
+	}
+};
+#endif
@@ -0,0 +1,256 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Core/TopDownInputSource.h"
+#include "Core/TopDownPlayer.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+APlayerController* UTopDownControllerInputSource::GetPlayerController() const
+{
+	// Resolved on every call, the pawn may be possessed after BeginPlay, unpossessed or handed to another controller
+	return Player ? Cast<APlayerController>(Player->GetController()) : nullptr;
+}
+
+FIntPoint UTopDownControllerInputSource::GetViewportSize() const
+{
+	APlayerController* LocalPlayerController = GetPlayerController();
+	if (!LocalPlayerController) return FIntPoint::ZeroValue;
+
+	int32 ViewportX, ViewportY;
+	LocalPlayerController->GetViewportSize(ViewportX, ViewportY);
+	return FIntPoint(ViewportX, ViewportY);
+}
+
+bool UTopDownControllerInputSource::GetMousePosition(FVector2D& OutScreenPos) const
+{
+	APlayerController* LocalPlayerController = GetPlayerController();
+	if (!LocalPlayerController) return false;
+
+	float MouseX, MouseY;
+	if (!LocalPlayerController->GetMousePosition(MouseX, MouseY)) return false;
+
+	OutScreenPos = FVector2D(MouseX, MouseY);
+	return true;
+}
+
+bool UTopDownControllerInputSource::GetTouchState(ETouchIndex::Type TouchIndex, FVector2D& OutScreenPos) const
+{
+	APlayerController* LocalPlayerController = GetPlayerController();
+	if (!LocalPlayerController) return false;
+
+	float TouchX, TouchY;
+	bool bIsCurrentlyPressed;
+	LocalPlayerController->GetInputTouchState(TouchIndex, TouchX, TouchY, bIsCurrentlyPressed);
+
+	OutScreenPos = FVector2D(TouchX, TouchY);
+	return bIsCurrentlyPressed;
+}
+
+bool UTopDownControllerInputSource::DeprojectScreenToWorld(const FVector2D& ScreenPos, FVector& OutWorldOrigin, FVector& OutWorldDirection) const
+{
+	APlayerController* LocalPlayerController = GetPlayerController();
+	if (!LocalPlayerController) return false;
+
+	return LocalPlayerController->DeprojectScreenPositionToWorld(ScreenPos.X, ScreenPos.Y, OutWorldOrigin, OutWorldDirection);
+}
+
+UTopDownSyntheticInputSource::UTopDownSyntheticInputSource()
+{
+	InputType = EInputType::KeyMouse;
+	ViewportSize = FIntPoint(1920, 1080);
+	bLoopScript = true;
+
+	PointerPosition = FVector2D(960.0f, 540.0f);
+	bTouchPressed = false;
+
+	ScriptTime = 0.0f;
+	ScriptKeyIndex = INDEX_NONE;
+
+	HeldAction = ETopDownSimulatedAction::None;
+}
+
+void UTopDownSyntheticInputSource::SetScript(const TArray<FTopDownSyntheticInputKey>& NewScript)
+{
+	if (Player && HeldAction != ETopDownSimulatedAction::None)
+	{
+		Player->SimulateAction(HeldAction, ETriggerEvent::Completed);
+	}
+	HeldAction = ETopDownSimulatedAction::None;
+
+	Script = NewScript;
+	ScriptTime = 0.0f;
+	ScriptKeyIndex = INDEX_NONE;
+}
+
+void UTopDownSyntheticInputSource::Update(float DeltaSeconds)
+{
+	if (Script.Num() == 0) return;
+
+	const float ScriptLength = Script.Last().Time;
+	const int32 PreviousKeyIndex = ScriptKeyIndex;
+	bool bLooped = false;
+
+	ScriptTime += DeltaSeconds;
+	if (ScriptTime > ScriptLength)
+	{
+		if (!bLoopScript || ScriptLength <= 0.0f)
+		{
+			ScriptKeyIndex = Script.Num() - 1;
+			PointerPosition = Script.Last().PointerPosition;
+			bTouchPressed = Script.Last().bTouchPressed;
+			UpdateHeldAction(ScriptKeyIndex != PreviousKeyIndex);
+			return;
+		}
+
+		ScriptTime = FMath::Fmod(ScriptTime, ScriptLength);
+		ScriptKeyIndex = 0;
+		bLooped = true;
+	}
+
+	ScriptKeyIndex = FMath::Max(ScriptKeyIndex, 0);
+
+	// Keys are sorted, so the current key only moves forward until the script loops
+	while (ScriptKeyIndex + 1 < Script.Num() && Script[ScriptKeyIndex + 1].Time <= ScriptTime)
+	{
+		++ScriptKeyIndex;
+	}
+
+	const FTopDownSyntheticInputKey& Key = Script[ScriptKeyIndex];
+	bTouchPressed = Key.bTouchPressed;
+
+	if (ScriptKeyIndex + 1 < Script.Num())
+	{
+		const FTopDownSyntheticInputKey& NextKey = Script[ScriptKeyIndex + 1];
+		const float Alpha = NextKey.Time > Key.Time ? (ScriptTime - Key.Time) / (NextKey.Time - Key.Time) : 1.0f;
+		PointerPosition = FMath::Lerp(Key.PointerPosition, NextKey.PointerPosition, FMath::Clamp(Alpha, 0.0f, 1.0f));
+	}
+	else
+	{
+		PointerPosition = Key.PointerPosition;
+	}
+
+	// Pressed after the pointer moved, so the action sees this update's position
+	UpdateHeldAction(bLooped || ScriptKeyIndex != PreviousKeyIndex);
+}
+
+void UTopDownSyntheticInputSource::UpdateHeldAction(bool bNewKey)
+{
+	if (!Player) return;
+
+	if (bNewKey)
+	{
+		if (HeldAction != ETopDownSimulatedAction::None)
+		{
+			Player->SimulateAction(HeldAction, ETriggerEvent::Completed);
+		}
+
+		HeldAction = Script[ScriptKeyIndex].Action;
+
+		if (HeldAction != ETopDownSimulatedAction::None)
+		{
+			Player->SimulateAction(HeldAction, ETriggerEvent::Started);
+		}
+	}
+
+	if (HeldAction != ETopDownSimulatedAction::None)
+	{
+		Player->SimulateAction(HeldAction, ETriggerEvent::Triggered);
+	}
+}
+
+void UTopDownSyntheticInputSource::MakeRandomScript(FRandomStream& RandomStream, const FIntPoint& ScriptViewportSize, int32 NumKeys, TArray<FTopDownSyntheticInputKey>& OutScript)
+{
+	static const ETopDownSimulatedAction Actions[] = {
+		ETopDownSimulatedAction::Select,
+		ETopDownSimulatedAction::Command,
+		ETopDownSimulatedAction::ZoomIn,
+		ETopDownSimulatedAction::ZoomOut
+	};
+
+	OutScript.Reset(NumKeys);
+
+	float KeyTime = 0.0f;
+	for (int32 KeyIndex = 0; KeyIndex < NumKeys; ++KeyIndex)
+	{
+		FTopDownSyntheticInputKey& Key = OutScript.AddDefaulted_GetRef();
+		Key.Time = KeyTime;
+		Key.PointerPosition = FVector2D(RandomStream.FRandRange(0.0f, ScriptViewportSize.X), RandomStream.FRandRange(0.0f, ScriptViewportSize.Y));
+		Key.Action = RandomStream.FRand() < 0.5f ? Actions[RandomStream.RandHelper(UE_ARRAY_COUNT(Actions))] : ETopDownSimulatedAction::None;
+		KeyTime += RandomStream.FRandRange(0.5f, 3.0f);
+	}
+}
+
+bool UTopDownSyntheticInputSource::GetMousePosition(FVector2D& OutScreenPos) const
+{
+	OutScreenPos = PointerPosition;
+	return true;
+}
+
+bool UTopDownSyntheticInputSource::GetTouchState(ETouchIndex::Type TouchIndex, FVector2D& OutScreenPos) const
+{
+	// Only a single finger is simulated
+	if (TouchIndex != ETouchIndex::Touch1) return false;
+
+	OutScreenPos = PointerPosition;
+	return bTouchPressed;
+}
+
+bool UTopDownSyntheticInputSource::DeprojectScreenToWorld(const FVector2D& ScreenPos, FVector& OutWorldOrigin, FVector& OutWorldDirection) const
+{
+	if (!Player) return false;
+
+	return Player->GetViewProjection().DeprojectScreenToWorld(ScreenPos, OutWorldOrigin, OutWorldDirection);
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorldAndArgs CmdSpawnSyntheticPlayers(
+	TEXT("TopDown.SpawnSyntheticPlayers"),
+	TEXT("Spawns AI possessed top-down players driven by random synthetic input scripts (pointer, select, command, zoom), for headless load tests. Usage: TopDown.SpawnSyntheticPlayers [Count=100] [Radius=20000]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World) return;
+
+		const int32 Count = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100;
+		const float Radius = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 20000.0f;
+
+		// Reuse the project's player class when a local top-down player exists
+		TSubclassOf<ATopDownPlayer> PlayerClass = ATopDownPlayer::StaticClass();
+		if (const APlayerController* FirstPlayerController = World->GetFirstPlayerController())
+		{
+			if (const ATopDownPlayer* LocalPlayer = Cast<ATopDownPlayer>(FirstPlayerController->GetPawn()))
+			{
+				PlayerClass = LocalPlayer->GetClass();
+			}
+		}
+
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		FRandomStream RandomStream(Count);
+		int32 NumSpawned = 0;
+
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			const FVector2D SpawnOffset = FVector2D(RandomStream.VRand()).GetSafeNormal() * RandomStream.FRandRange(0.0f, Radius);
+			ATopDownPlayer* SyntheticPlayer = World->SpawnActor<ATopDownPlayer>(PlayerClass, FVector(SpawnOffset, 0.0f), FRotator::ZeroRotator, SpawnParameters);
+			if (!SyntheticPlayer) continue;
+
+			UTopDownSyntheticInputSource* Source = NewObject<UTopDownSyntheticInputSource>(SyntheticPlayer);
+
+			// Wander the pointer across the virtual viewport, crossing the edge scrolling margins, and press an action on every other key
+			TArray<FTopDownSyntheticInputKey> Script;
+			UTopDownSyntheticInputSource::MakeRandomScript(RandomStream, Source->ViewportSize, RandomStream.RandRange(4, 8), Script);
+			Source->SetScript(Script);
+
+			SyntheticPlayer->SetInputSource(Source);
+
+			// The floating pawn movement only applies input for locally controlled pawns
+			SyntheticPlayer->SpawnDefaultController();
+			++NumSpawned;
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("Spawned %d synthetic top-down players"), NumSpawned);
+	})
+);
+#endif
@@ -0,0 +1,52 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Core/TopDownLatencyTracker.h"
+#include "HAL/PlatformTime.h"
+
+FTopDownLatencyTracker::FTopDownLatencyTracker(int32 InCapacity)
+{
+	LatenciesMs.SetNumZeroed(FMath::Max(InCapacity, 1));
+	NextIndex = 0;
+	NumSamples = 0;
+	PendingSampleTime = -1.0;
+}
+
+void FTopDownLatencyTracker::MarkInputSample()
+{
+	if (PendingSampleTime < 0.0)
+	{
+		PendingSampleTime = FPlatformTime::Seconds();
+	}
+}
+
+void FTopDownLatencyTracker::MarkCameraApplied()
+{
+	if (PendingSampleTime < 0.0) return;
+
+	LatenciesMs[NextIndex] = static_cast<float>((FPlatformTime::Seconds() - PendingSampleTime) * 1000.0);
+	NextIndex = (NextIndex + 1) % LatenciesMs.Num();
+	NumSamples = FMath::Min(NumSamples + 1, LatenciesMs.Num());
+
+	PendingSampleTime = -1.0;
+}
+
+void FTopDownLatencyTracker::GetPercentiles(float& OutP50Ms, float& OutP99Ms) const
+{
+	OutP50Ms = 0.0f;
+	OutP99Ms = 0.0f;
+
+	if (NumSamples == 0) return;
+
+	TArray<float> Sorted(LatenciesMs.GetData(), NumSamples);
+	Sorted.Sort();
+
+	OutP50Ms = Sorted[FMath::Min(FMath::FloorToInt32(NumSamples * 0.5f), NumSamples - 1)];
+	OutP99Ms = Sorted[FMath::Min(FMath::FloorToInt32(NumSamples * 0.99f), NumSamples - 1)];
+}
+
+void FTopDownLatencyTracker::Reset()
+{
+	NextIndex = 0;
+	NumSamples = 0;
+	PendingSampleTime = -1.0;
+}
@@ -0,0 +1,369 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Core/TopDownOcclusionComponent.h"
+#include "Core/TopDownSelectionSubsystem.h"
+#include "TopDownMovement.h"
+#include "Camera/CameraComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "GameFramework/Pawn.h"
+#include "LandscapeProxy.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Occlusion Batch"), STAT_TopDownOcclusionBatch, STATGROUP_TopDownMovement);
+DECLARE_CYCLE_STAT(TEXT("Occlusion Fade"), STAT_TopDownOcclusionFade, STATGROUP_TopDownMovement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Occlusion Sweeps"), STAT_TopDownOcclusionSweeps, STATGROUP_TopDownMovement);
+
+UTopDownOcclusionComponent::UTopDownOcclusionComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+
+	bEnableOcclusionFade = true;
+	OcclusionCheckInterval = 0.15f;
+	OcclusionTraceChannel = ECC_Camera;
+	OcclusionSweepRadius = 60.f;
+	OcclusionTargetHeight = 150.f;
+	MaxSelectedTargets = 16;
+	FadedOpacity = 0.25f;
+	FadeSpeed = 4.0f;
+	FadeParameterName = TEXT("Fade");
+
+	PendingTraces = 0;
+	BatchId = 0;
+}
+
+void UTopDownOcclusionComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	Camera = GetOwner()->FindComponentByClass<UCameraComponent>();
+	TraceDelegate.BindUObject(this, &UTopDownOcclusionComponent::OnOcclusionTraceCompleted);
+
+	if (APawn* OwnerPawn = Cast<APawn>(GetOwner()))
+	{
+		OwnerPawn->ReceiveControllerChangedDelegate.AddDynamic(this, &UTopDownOcclusionComponent::OnOwnerControllerChanged);
+	}
+
+	UpdateOcclusionTimer();
+}
+
+void UTopDownOcclusionComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (APawn* OwnerPawn = Cast<APawn>(GetOwner()))
+	{
+		OwnerPawn->ReceiveControllerChangedDelegate.RemoveDynamic(this, &UTopDownOcclusionComponent::OnOwnerControllerChanged);
+	}
+
+	GetWorld()->GetTimerManager().ClearTimer(OcclusionTimerHandle);
+	TraceDelegate.Unbind();
+
+	ResetOcclusion();
+	InstancePools.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+bool UTopDownOcclusionComponent::ShouldCheckOcclusion() const
+{
+	if (const APawn* OwnerPawn = Cast<APawn>(GetOwner()))
+	{
+		return OwnerPawn->IsLocallyControlled() && OwnerPawn->IsPlayerControlled();
+	}
+
+	return GetNetMode() != NM_DedicatedServer;
+}
+
+void UTopDownOcclusionComponent::UpdateOcclusionTimer()
+{
+	FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+
+	if (ShouldCheckOcclusion())
+	{
+		if (!TimerManager.IsTimerActive(OcclusionTimerHandle))
+		{
+			TimerManager.SetTimer(
+				OcclusionTimerHandle,
+				this,
+				&UTopDownOcclusionComponent::StartOcclusionBatch,
+				OcclusionCheckInterval,
+				true
+			);
+		}
+	}
+	else if (OcclusionTimerHandle.IsValid())
+	{
+		TimerManager.ClearTimer(OcclusionTimerHandle);
+		ResetOcclusion();
+	}
+}
+
+void UTopDownOcclusionComponent::SetOcclusionCheckInterval(float NewInterval)
+{
+	OcclusionCheckInterval = FMath::Max(NewInterval, 0.01f);
+
+	// The timer keeps the rate it was set with, re-arm it with the new one
+	UWorld* World = GetWorld();
+	if (World && OcclusionTimerHandle.IsValid())
+	{
+		World->GetTimerManager().ClearTimer(OcclusionTimerHandle);
+		UpdateOcclusionTimer();
+	}
+}
+
+void UTopDownOcclusionComponent::CheckOcclusionNow()
+{
+	if (!ShouldCheckOcclusion()) return;
+
+	StartOcclusionBatch();
+}
+
+void UTopDownOcclusionComponent::OnOwnerControllerChanged(APawn* Pawn, AController* OldController, AController* NewController)
+{
+	UpdateOcclusionTimer();
+}
+
+void UTopDownOcclusionComponent::ResetOcclusion()
+{
+	// Answers to the traces in flight no longer match the batch id and are ignored
+	++BatchId;
+	PendingTraces = 0;
+	BatchOccluders.Reset();
+
+	for (FTopDownOcclusionFade& Fade : ActiveFades)
+	{
+		EndFade(Fade);
+	}
+	ActiveFades.Reset();
+
+	SetComponentTickEnabled(false);
+}
+
+void UTopDownOcclusionComponent::StartOcclusionBatch()
+{
+	// The previous batch has not been answered yet, skip this interval instead of stacking traces
+	if (!Camera || PendingTraces > 0) return;
+
+	SCOPE_CYCLE_COUNTER(STAT_TopDownOcclusionBatch);
+
+	++BatchId;
+	BatchOccluders.Reset();
+
+	if (!bEnableOcclusionFade)
+	{
+		FinishOcclusionBatch();
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	const FVector CameraLocation = Camera->GetComponentLocation();
+	const FCollisionShape SweepShape = FCollisionShape::MakeSphere(OcclusionSweepRadius);
+
+	// Blocking hits are reported as overlaps, a multi sweep would otherwise end at the first occluder
+	FCollisionResponseParams ResponseParams;
+	ResponseParams.CollisionResponse.SetAllChannels(ECR_Overlap);
+
+	auto SweepTo = [&](const FVector& TargetLocation, const AActor* TargetActor)
+	{
+		FCollisionQueryParams Params(SCENE_QUERY_STAT(TopDownOcclusion), false, GetOwner());
+		if (TargetActor)
+		{
+			Params.AddIgnoredActor(TargetActor);
+		}
+
+		// Aim above the target and stop a radius short of it, so the sphere does not reach the ground under it
+		const FVector RaisedTarget = TargetLocation + FVector(0.0f, 0.0f, OcclusionTargetHeight);
+		const FVector SweepEnd = RaisedTarget + (CameraLocation - RaisedTarget).GetSafeNormal() * OcclusionSweepRadius;
+
+		World->AsyncSweepByChannel(EAsyncTraceType::Multi, CameraLocation, SweepEnd, FQuat::Identity, OcclusionTraceChannel, SweepShape, Params, ResponseParams, &TraceDelegate, BatchId);
+		++PendingTraces;
+		INC_DWORD_STAT(STAT_TopDownOcclusionSweeps);
+	};
+
+	SweepTo(GetOwner()->GetActorLocation(), nullptr);
+
+	if (const UTopDownSelectionSubsystem* SelectionSubsystem = World->GetSubsystem<UTopDownSelectionSubsystem>())
+	{
+		const TArray<TObjectPtr<AActor>>& Selection = SelectionSubsystem->GetSelection();
+		for (int32 Index = 0; Index < FMath::Min(Selection.Num(), MaxSelectedTargets); ++Index)
+		{
+			if (const AActor* SelectedActor = Selection[Index])
+			{
+				SweepTo(SelectedActor->GetActorLocation(), SelectedActor);
+			}
+		}
+	}
+}
+
+void UTopDownOcclusionComponent::OnOcclusionTraceCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	// Results of a batch started before EndPlay or before the last reset
+	if (TraceDatum.UserData != BatchId || PendingTraces == 0) return;
+
+	const UTopDownSelectionSubsystem* SelectionSubsystem = GetWorld()->GetSubsystem<UTopDownSelectionSubsystem>();
+
+	for (const FHitResult& Hit : TraceDatum.OutHits)
+	{
+		UPrimitiveComponent* HitComponent = Hit.GetComponent();
+		if (!HitComponent) continue;
+
+		// Units are never faded, only the world geometry in front of them
+		const AActor* HitActor = HitComponent->GetOwner();
+		if (SelectionSubsystem && SelectionSubsystem->IsSelectable(HitActor)) continue;
+
+		// Neither is the ground: the landscape, and anything whose top is below the end of the sweep
+		if (Cast<ALandscapeProxy>(HitActor)) continue;
+		if (HitComponent->Bounds.Origin.Z + HitComponent->Bounds.BoxExtent.Z <= TraceDatum.End.Z) continue;
+
+		BatchOccluders.Add(HitComponent);
+	}
+
+	if (--PendingTraces == 0)
+	{
+		FinishOcclusionBatch();
+	}
+}
+
+void UTopDownOcclusionComponent::FinishOcclusionBatch()
+{
+	bool bNeedsTick = false;
+
+	for (FTopDownOcclusionFade& Fade : ActiveFades)
+	{
+		const bool bStillOccluding = BatchOccluders.Remove(Fade.Component) > 0;
+		Fade.TargetOpacity = bStillOccluding ? FadedOpacity : 1.0f;
+		bNeedsTick |= Fade.Opacity != Fade.TargetOpacity;
+	}
+
+	// Whatever is left was not occluding during the previous batch
+	for (const TWeakObjectPtr<UPrimitiveComponent>& Occluder : BatchOccluders)
+	{
+		if (UPrimitiveComponent* Component = Occluder.Get())
+		{
+			BeginFade(Component);
+			bNeedsTick = true;
+		}
+	}
+	BatchOccluders.Reset();
+
+	if (bNeedsTick)
+	{
+		SetComponentTickEnabled(true);
+	}
+}
+
+void UTopDownOcclusionComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	SCOPE_CYCLE_COUNTER(STAT_TopDownOcclusionFade);
+
+	bool bAnyFading = false;
+
+	for (int32 Index = ActiveFades.Num() - 1; Index >= 0; --Index)
+	{
+		FTopDownOcclusionFade& Fade = ActiveFades[Index];
+
+		if (!Fade.Component.IsValid())
+		{
+			EndFade(Fade);
+			ActiveFades.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		if (Fade.Opacity != Fade.TargetOpacity)
+		{
+			Fade.Opacity = FMath::FInterpConstantTo(Fade.Opacity, Fade.TargetOpacity, DeltaTime, FadeSpeed);
+			for (UMaterialInstanceDynamic* Instance : Fade.FadeInstances)
+			{
+				Instance->SetScalarParameterValue(FadeParameterName, Fade.Opacity);
+			}
+		}
+
+		if (Fade.Opacity >= 1.0f && Fade.TargetOpacity >= 1.0f)
+		{
+			EndFade(Fade);
+			ActiveFades.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		bAnyFading |= Fade.Opacity != Fade.TargetOpacity;
+	}
+
+	if (!bAnyFading)
+	{
+		SetComponentTickEnabled(false);
+	}
+}
+
+void UTopDownOcclusionComponent::BeginFade(UPrimitiveComponent* Component)
+{
+	FTopDownOcclusionFade& Fade = ActiveFades.AddDefaulted_GetRef();
+	Fade.Component = Component;
+	Fade.Opacity = 1.0f;
+	Fade.TargetOpacity = FadedOpacity;
+
+	const int32 NumMaterials = Component->GetNumMaterials();
+	Fade.OriginalMaterials.Reserve(NumMaterials);
+	Fade.FadeInstances.Reserve(NumMaterials);
+
+	for (int32 MaterialIndex = 0; MaterialIndex < NumMaterials; ++MaterialIndex)
+	{
+		UMaterialInterface* OriginalMaterial = Component->GetMaterial(MaterialIndex);
+		Fade.OriginalMaterials.Add(OriginalMaterial);
+
+		if (!OriginalMaterial) continue;
+
+		UMaterialInstanceDynamic* Instance = AcquireInstance(OriginalMaterial);
+		Fade.FadeInstances.Add(Instance);
+		Component->SetMaterial(MaterialIndex, Instance);
+	}
+}
+
+void UTopDownOcclusionComponent::EndFade(FTopDownOcclusionFade& Fade)
+{
+	if (UPrimitiveComponent* Component = Fade.Component.Get())
+	{
+		for (int32 MaterialIndex = 0; MaterialIndex < Fade.OriginalMaterials.Num(); ++MaterialIndex)
+		{
+			if (Fade.OriginalMaterials[MaterialIndex])
+			{
+				Component->SetMaterial(MaterialIndex, Fade.OriginalMaterials[MaterialIndex]);
+			}
+		}
+	}
+
+	for (UMaterialInstanceDynamic* Instance : Fade.FadeInstances)
+	{
+		ReleaseInstance(Instance);
+	}
+
+	Fade.OriginalMaterials.Reset();
+	Fade.FadeInstances.Reset();
+}
+
+UMaterialInstanceDynamic* UTopDownOcclusionComponent::AcquireInstance(UMaterialInterface* ParentMaterial)
+{
+	UMaterialInstanceDynamic* Instance = nullptr;
+
+	FTopDownMaterialInstancePool& Pool = InstancePools.FindOrAdd(ParentMaterial);
+	if (Pool.Instances.Num() > 0)
+	{
+		Instance = Pool.Instances.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		Instance = UMaterialInstanceDynamic::Create(ParentMaterial, this);
+	}
+
+	Instance->SetScalarParameterValue(FadeParameterName, 1.0f);
+	return Instance;
+}
+
+void UTopDownOcclusionComponent::ReleaseInstance(UMaterialInstanceDynamic* Instance)
+{
+	if (!Instance) return;
+
+	InstancePools.FindOrAdd(Instance->Parent).Instances.Add(Instance);
+}
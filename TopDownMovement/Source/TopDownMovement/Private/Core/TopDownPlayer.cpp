@@ -1,8 +1,16 @@
 // The source code, authored by Zoxemik in 2025
 
 #include "Core/TopDownPlayer.h"
+#include "TopDownMovement.h"
 #include "Core/InputDataSetup.h"
 #include "Core/TopDownController.h"
+#include "Core/TopDownSignificanceSubsystem.h"
+#include "Core/TopDownSelectionSubsystem.h"
+#include "Core/TopDownCommandSubsystem.h"
+#include "Core/TopDownInputPolicies.h"
+#include "Core/TopDownOcclusionComponent.h"
+#include "Core/TopDownInputSource.h"
+#include "Core/TopDownRelevancySubsystem.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "GameFramework/FloatingPawnMovement.h"
 #include "Camera/CameraComponent.h"
@@ -12,13 +20,27 @@
 #include "EnhancedInputSubsystems.h"
 #include "EnhancedInputComponent.h"
 #include "Kismet/KismetMathLibrary.h"
-#include "TimerManager.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "WorldPartition/WorldPartitionSubsystem.h"
+
+DECLARE_CYCLE_STAT(TEXT("Player Tick"), STAT_TopDownPlayerTick, STATGROUP_TopDownMovement);
+DECLARE_CYCLE_STAT(TEXT("Update Ground Footprint"), STAT_TopDownUpdateGroundFootprint, STATGROUP_TopDownMovement);
+DECLARE_CYCLE_STAT(TEXT("Project World Locations"), STAT_TopDownProjectWorldLocations, STATGROUP_TopDownMovement);
+DECLARE_CYCLE_STAT(TEXT("Virtual Cursor Snap Query"), STAT_TopDownSnapQuery, STATGROUP_TopDownMovement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Virtual Cursor Snap Budget Exhausted"), STAT_TopDownSnapBudgetExhausted, STATGROUP_TopDownMovement);
 
 
 ATopDownPlayer::ATopDownPlayer()
 {
- 	// Set this pawn to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
-	PrimaryActorTick.bCanEverTick = false;
+ 	// Tick after input processing and physics, but before the camera manager computes the view,
+	// so pointer driven movement reaches the camera in the same frame it was sampled
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.TickGroup = TG_PostPhysics;
+
+	PostMovementTickFunction.bCanEverTick = true;
+	PostMovementTickFunction.bStartWithTickEnabled = true;
+	PostMovementTickFunction.TickGroup = TG_PostPhysics;
 
 	Root = CreateDefaultSubobject<USceneComponent>(TEXT("RootComponent"));
 	SetRootComponent(Root);
@@ -64,6 +86,10 @@ ATopDownPlayer::ATopDownPlayer()
 	MovementComponent->bConstrainToPlane = true;
 	MovementComponent->bSnapToPlaneAtStart = true;
 	MovementComponent->ConstrainNormalToPlane(FVector(0.0f, 0.0f, 1.0f));
+	MovementComponent->PrimaryComponentTick.TickGroup = TG_PostPhysics;
+
+	// Occlusion
+	OcclusionComponent = CreateDefaultSubobject<UTopDownOcclusionComponent>(TEXT("OcclusionComponent"));
 
 	ZoomDirection = 0.f;
 	ZoomValue = 0.5f;
@@ -74,8 +100,62 @@ ATopDownPlayer::ATopDownPlayer()
 	EdgeMoveDistance = 50.f;
 
 	CurrentInputType = EInputType::Unknown;
+	SelectInputRoutines<FTopDownNoInputPolicy>();
 
 	TargetHandle = FVector(0.0f, 0.0f, 0.0f);
+
+	bEnableStreamingSource = true;
+	bStreamingSourceRegistered = false;
+	StreamingViewCenter = FVector::ZeroVector;
+	StreamingViewVelocity = FVector::ZeroVector;
+	bStreamingViewCenterFromFootprint = false;
+	bHasStreamingViewCenter = false;
+	StreamingPredictionTime = 1.5f;
+	StreamingRadiusScale = 1.25f;
+	StreamingSourcePriority = EStreamingSourcePriority::High;
+
+	FootprintViewLocation = FVector::ZeroVector;
+	FootprintViewRotation = FRotator::ZeroRotator;
+	FootprintFieldOfView = 0.0f;
+	FootprintViewportSize = FIntPoint::ZeroValue;
+
+	bRecordInputLatency = false;
+	bInputMovePending = false;
+	bApplyingNonInputMove = false;
+	bWasEdgeScrolling = false;
+	bDragMovePending = false;
+	bSimulatedDragActive = false;
+
+	ViewProjectionRotation = FRotator::ZeroRotator;
+	ViewProjectionFieldOfView = 0.0f;
+
+	VirtualCursorSpeed = 900.f;
+	VirtualCursorRampTime = 0.35f;
+	VirtualCursorInitialSpeedScale = 0.4f;
+	bEnableAimAssist = true;
+	VirtualCursorSnapRadius = 60.f;
+	VirtualCursorSnapSpeed = 15.f;
+	VirtualCursorSnapFriction = 0.5f;
+	VirtualCursorSnapBudgetMs = 0.2f;
+
+	VirtualCursorPosition = FVector2D(-1.0f, -1.0f);
+	VirtualCursorInput = FVector2D::ZeroVector;
+	VirtualCursorHoldTime = 0.0f;
+
+	GroupFollowSpeed = 3.0f;
+	GroupFollowFill = 0.6f;
+	GroupFollowZoomSpeed = 0.5f;
+	GroupFollowZoomTolerance = 0.15f;
+	bFollowingGroup = false;
+
+	bInputAssetsRequested = false;
+	bInputAssetsLoaded = false;
+	AssetsLoadStartTime = 0.0;
+
+	CameraInterestInterval = 0.1f;
+	CameraInterestTolerance = 250.0f;
+	LastCameraInterestTime = 0.0;
+	bCameraInterestSent = false;
 }
 
 void ATopDownPlayer::BeginPlay()
@@ -85,31 +165,490 @@ void ATopDownPlayer::BeginPlay()
 	CollisionSphere->OnComponentBeginOverlap.AddDynamic(this, &ATopDownPlayer::OverlapBegin);
 	CollisionSphere->OnComponentEndOverlap.AddDynamic(this, &ATopDownPlayer::OverlapEnd);
 
-	PlayerController = Cast<APlayerController>(GetController());
+	LoadAssets();
+
+	// Possession usually happens after BeginPlay, NotifyControllerChanged repeats this when it does
+	SetupPlayerController();
+
+	SetInputSource(InputSource ? InputSource.Get() : NewObject<UTopDownControllerInputSource>(this));
+
+	SignificanceSubsystem = GetWorld()->GetSubsystem<UTopDownSignificanceSubsystem>();
+	SelectionSubsystem = GetWorld()->GetSubsystem<UTopDownSelectionSubsystem>();
+
+	UpdateZoom();
+
+	// Input -> pawn (drag, edge scroll) -> movement component -> camera manager, the controller is added in SetupPlayerController
+	MovementComponent->AddTickPrerequisiteActor(this);
+
+	RootComponent->TransformUpdated.AddUObject(this, &ATopDownPlayer::OnRootTransformUpdated);
+}
+
+void ATopDownPlayer::RegisterActorTickFunctions(bool bRegister)
+{
+	Super::RegisterActorTickFunctions(bRegister);
 
-	if (PlayerController)
+	if (bRegister)
 	{
-		if (TObjectPtr<UEnhancedInputLocalPlayerSubsystem> Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PlayerController->GetLocalPlayer()))
+		if (!PostMovementTickFunction.bCanEverTick) return;
+
+		PostMovementTickFunction.Target = this;
+		PostMovementTickFunction.SetTickFunctionEnable(PostMovementTickFunction.bStartWithTickEnabled);
+		PostMovementTickFunction.RegisterTickFunction(GetLevel());
+
+		// Input offsets in Tick, then the movement component move, then the spring arm placing the camera
+		PostMovementTickFunction.AddPrerequisite(this, PrimaryActorTick);
+		PostMovementTickFunction.AddPrerequisite(MovementComponent, MovementComponent->PrimaryComponentTick);
+		PostMovementTickFunction.AddPrerequisite(SpringArm, SpringArm->PrimaryComponentTick);
+	}
+	else if (PostMovementTickFunction.IsTickFunctionRegistered())
+	{
+		PostMovementTickFunction.UnRegisterTickFunction();
+	}
+}
+
+void ATopDownPlayer::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	StopGroupFollow();
+
+	// Drop the handles so the assets can be collected once no other player holds them
+	if (AssetsHandle.IsValid())
+	{
+		AssetsHandle->CancelHandle();
+		AssetsHandle.Reset();
+	}
+	if (InputAssetsHandle.IsValid())
+	{
+		InputAssetsHandle->CancelHandle();
+		InputAssetsHandle.Reset();
+	}
+	if (InputActionsHandle.IsValid())
+	{
+		InputActionsHandle->CancelHandle();
+		InputActionsHandle.Reset();
+	}
+	PendingInputComponent.Reset();
+
+	RemoveCameraInterestViewer();
+
+	if (bStreamingSourceRegistered)
+	{
+		if (UWorldPartitionSubsystem* WorldPartitionSubsystem = GetWorld()->GetSubsystem<UWorldPartitionSubsystem>())
 		{
-			Subsystem->AddMappingContext(BaseInputMappingContext, 0);
-			Subsystem->AddMappingContext(SelectMappingContext, 0);
+			WorldPartitionSubsystem->UnregisterStreamingSourceProvider(this);
 		}
+		bStreamingSourceRegistered = false;
 	}
 
-	if (ATopDownController* TopDownPlayerController = Cast<ATopDownController>(GetController()))
+	if (bRecordInputLatency)
 	{
-		TopDownPlayerController->OnKeySwitch.AddDynamic(this, &ATopDownPlayer::HandleInputTypeSwitched);
+		float P50Ms, P99Ms;
+		InputLatency.GetPercentiles(P50Ms, P99Ms);
+		UE_LOG(LogTemp, Log, TEXT("TopDownPlayer input to camera latency: p50 %.2f ms, p99 %.2f ms (%d samples)"), P50Ms, P99Ms, InputLatency.GetNumSamples());
 	}
 
-	UpdateZoom();
+	Super::EndPlay(EndPlayReason);
+}
+
+void ATopDownPlayer::NotifyControllerChanged()
+{
+	Super::NotifyControllerChanged();
+
+	// Unpossessed or handed to another controller, the previous controller's connection no longer sees through this camera
+	if (CameraInterestViewer.IsValid() && CameraInterestViewer.Get() != GetController())
+	{
+		RemoveCameraInterestViewer();
+	}
+
+	if (HasActorBegunPlay())
+	{
+		SetupPlayerController();
+	}
+}
+
+void ATopDownPlayer::SetupPlayerController()
+{
+	APlayerController* NewPlayerController = Cast<APlayerController>(GetController());
+	if (NewPlayerController != PlayerController)
+	{
+		if (PlayerController)
+		{
+			RemoveMappingContexts();
+			RemoveTickPrerequisiteActor(PlayerController);
+
+			if (ATopDownController* OldTopDownController = Cast<ATopDownController>(PlayerController))
+			{
+				OldTopDownController->OnKeySwitch.RemoveDynamic(this, &ATopDownPlayer::HandleInputTypeSwitched);
+			}
+		}
+
+		PlayerController = NewPlayerController;
+
+		// The controller processes input before the pawn ticks, so drag and edge scrolling use this frame's input
+		if (PlayerController)
+		{
+			AddTickPrerequisiteActor(PlayerController);
+		}
+
+		if (ATopDownController* TopDownPlayerController = Cast<ATopDownController>(PlayerController))
+		{
+			TopDownPlayerController->OnKeySwitch.AddUniqueDynamic(this, &ATopDownPlayer::HandleInputTypeSwitched);
+		}
+	}
+
+	UpdateStreamingSourceRegistration();
+
+	// Only a local player drives the pawn's input, servers and simulated proxies never load the input assets
+	if (!PlayerController || !IsLocallyControlled()) return;
+
+	if (bInputAssetsLoaded)
+	{
+		AddMappingContexts();
+	}
+	else if (!bInputAssetsRequested)
+	{
+		LoadInputAssets();
+	}
+}
+
+void ATopDownPlayer::LoadAssets()
+{
+	const FSoftObjectPath ZoomCurvePath = ZoomCurve.ToSoftObjectPath();
+	if (ZoomCurvePath.IsNull())
+	{
+		OnAssetsLoaded();
+		return;
+	}
+
+	AssetsHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(ZoomCurvePath, FStreamableDelegate::CreateUObject(this, &ATopDownPlayer::OnAssetsLoaded));
+}
+
+void ATopDownPlayer::OnAssetsLoaded()
+{
+	ApplyZoom();
+}
+
+void ATopDownPlayer::GetInputAssetPaths(TArray<FSoftObjectPath>& OutAssetPaths) const
+{
+	OutAssetPaths.Add(InputActions.ToSoftObjectPath());
+	OutAssetPaths.Add(BaseInputMappingContext.ToSoftObjectPath());
+	OutAssetPaths.Add(DragMoveMappingContext.ToSoftObjectPath());
+	OutAssetPaths.Add(SelectMappingContext.ToSoftObjectPath());
+#if TOPDOWN_WITH_TOUCH
+	OutAssetPaths.Add(TouchMappingContext.ToSoftObjectPath());
+#endif
+#if TOPDOWN_WITH_GAMEPAD
+	OutAssetPaths.Add(GamepadMappingContext.ToSoftObjectPath());
+	OutAssetPaths.Add(VirtualCursorAccelerationCurve.ToSoftObjectPath());
+#endif
+
+	OutAssetPaths.RemoveAll([](const FSoftObjectPath& Path) { return Path.IsNull(); });
+}
+
+void ATopDownPlayer::LoadInputAssets()
+{
+	bInputAssetsRequested = true;
+	AssetsLoadStartTime = FPlatformTime::Seconds();
+
+	TArray<FSoftObjectPath> AssetPaths;
+	GetInputAssetPaths(AssetPaths);
+
+	if (AssetPaths.Num() == 0)
+	{
+		OnInputDataLoaded();
+		return;
+	}
+
+	InputAssetsHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(AssetPaths, FStreamableDelegate::CreateUObject(this, &ATopDownPlayer::OnInputDataLoaded));
+}
+
+void ATopDownPlayer::OnInputDataLoaded()
+{
+	// The data asset only soft references its actions, they are streamed as a second step
+	const UInputDataSetup* LoadedInputActions = InputActions.Get();
+	if (!LoadedInputActions)
+	{
+		OnInputAssetsLoaded();
+		return;
+	}
+
+	TArray<FSoftObjectPath> ActionPaths;
+	LoadedInputActions->GetActionsToLoad(ActionPaths);
+
+	if (ActionPaths.Num() == 0)
+	{
+		OnInputAssetsLoaded();
+		return;
+	}
+
+	InputActionsHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(ActionPaths, FStreamableDelegate::CreateUObject(this, &ATopDownPlayer::OnInputAssetsLoaded));
+}
+
+void ATopDownPlayer::OnInputAssetsLoaded()
+{
+	bInputAssetsLoaded = true;
+
+	AddMappingContexts();
+
+	if (UEnhancedInputComponent* EnhancedInputComponent = PendingInputComponent.Get())
+	{
+		BindInputActions(EnhancedInputComponent);
+	}
+	PendingInputComponent.Reset();
+
+	UE_LOG(LogTemp, Log, TEXT("TopDownPlayer input assets streamed in %.2f ms"), (FPlatformTime::Seconds() - AssetsLoadStartTime) * 1000.0);
+}
+
+void ATopDownPlayer::AddMappingContexts()
+{
+	if (!PlayerController) return;
 
-	GetWorld()->GetTimerManager().SetTimer(
-		MoveTrackingTimerHandle,
-		this,
-		&ATopDownPlayer::MoveTracking,
-		0.01667f,
-		true
-	);
+	if (TObjectPtr<UEnhancedInputLocalPlayerSubsystem> Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PlayerController->GetLocalPlayer()))
+	{
+		Subsystem->AddMappingContext(BaseInputMappingContext.Get(), 0);
+		Subsystem->AddMappingContext(SelectMappingContext.Get(), 0);
+#if TOPDOWN_WITH_TOUCH
+		Subsystem->AddMappingContext(TouchMappingContext.Get(), 0);
+#endif
+#if TOPDOWN_WITH_GAMEPAD
+		Subsystem->AddMappingContext(GamepadMappingContext.Get(), 0);
+#endif
+	}
+}
+
+void ATopDownPlayer::RemoveMappingContexts()
+{
+	if (!PlayerController || !bInputAssetsLoaded) return;
+
+	if (TObjectPtr<UEnhancedInputLocalPlayerSubsystem> Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PlayerController->GetLocalPlayer()))
+	{
+		Subsystem->RemoveMappingContext(BaseInputMappingContext.Get());
+		Subsystem->RemoveMappingContext(SelectMappingContext.Get());
+		Subsystem->RemoveMappingContext(DragMoveMappingContext.Get());
+#if TOPDOWN_WITH_TOUCH
+		Subsystem->RemoveMappingContext(TouchMappingContext.Get());
+#endif
+#if TOPDOWN_WITH_GAMEPAD
+		Subsystem->RemoveMappingContext(GamepadMappingContext.Get());
+#endif
+	}
+}
+
+void ATopDownPlayer::UpdateStreamingSourceRegistration()
+{
+	UWorldPartitionSubsystem* WorldPartitionSubsystem = GetWorld()->GetSubsystem<UWorldPartitionSubsystem>();
+	if (!WorldPartitionSubsystem) return;
+
+	// Clients stream around their own camera, the server around the pawn of every player. Simulated proxies and AI never stream
+	const bool bShouldRegister = bEnableStreamingSource && IsPlayerControlled() && (IsLocallyControlled() || HasAuthority());
+	if (bShouldRegister == bStreamingSourceRegistered) return;
+
+	if (bShouldRegister)
+	{
+		WorldPartitionSubsystem->RegisterStreamingSourceProvider(this);
+	}
+	else
+	{
+		WorldPartitionSubsystem->UnregisterStreamingSourceProvider(this);
+	}
+	bStreamingSourceRegistered = bShouldRegister;
+}
+
+void ATopDownPlayer::UpdateStreamingViewVelocity(float DeltaSeconds)
+{
+	// Drag and origin pull move the pawn with AddActorWorldOffset, which leaves the movement component velocity at zero,
+	// so the prediction follows the view center instead. Smoothed over a quarter second to ride out single frame jumps
+	constexpr float SmoothingTime = 0.25f;
+
+	const bool bFromFootprint = GroundFootprint.bIsValid;
+	const FVector ViewCenter = bFromFootprint ? GroundFootprint.Center : GetActorLocation();
+
+	// A switch between footprint and pawn location is not a move
+	if (bHasStreamingViewCenter && bFromFootprint == bStreamingViewCenterFromFootprint && DeltaSeconds > UE_SMALL_NUMBER)
+	{
+		const FVector FrameVelocity = (ViewCenter - StreamingViewCenter) / DeltaSeconds;
+		StreamingViewVelocity = FMath::Lerp(StreamingViewVelocity, FrameVelocity, FMath::Min(DeltaSeconds / SmoothingTime, 1.0f));
+	}
+
+	StreamingViewCenter = ViewCenter;
+	bStreamingViewCenterFromFootprint = bFromFootprint;
+	bHasStreamingViewCenter = true;
+}
+
+bool ATopDownPlayer::GetStreamingSources(TArray<FWorldPartitionStreamingSource>& OutStreamingSources) const
+{
+	if (!bEnableStreamingSource) return false;
+
+	const FVector CurrentLocation = GroundFootprint.bIsValid ? GroundFootprint.Center : GetActorLocation();
+	const FVector Velocity = StreamingViewVelocity;
+	const float Radius = GetGroundFootprintRadius() * StreamingRadiusScale;
+
+	FWorldPartitionStreamingSource& StreamingSource = OutStreamingSources.AddDefaulted_GetRef();
+	StreamingSource.Name = GetFName();
+	StreamingSource.Location = CurrentLocation;
+	StreamingSource.Rotation = FRotator::ZeroRotator;
+	StreamingSource.TargetState = EStreamingSourceTargetState::Activated;
+	StreamingSource.Priority = StreamingSourcePriority;
+	StreamingSource.Velocity = Velocity.Size2D();
+
+	// Keep the cells under the camera loaded
+	FStreamingSourceShape& CurrentShape = StreamingSource.Shapes.AddDefaulted_GetRef();
+	CurrentShape.bUseGridLoadingRange = false;
+	CurrentShape.Radius = Radius;
+
+	// Extrapolate along the pan direction so cells are requested before the camera arrives.
+	// The shape offset is relative to the source, which is kept unrotated to stay in world space
+	const FVector PredictedOffset = FVector(Velocity.X, Velocity.Y, 0.0f) * StreamingPredictionTime;
+	if (!PredictedOffset.IsNearlyZero(Radius * 0.1f))
+	{
+		FStreamingSourceShape& PredictedShape = StreamingSource.Shapes.AddDefaulted_GetRef();
+		PredictedShape.bUseGridLoadingRange = false;
+		PredictedShape.Radius = Radius;
+		PredictedShape.Location = PredictedOffset;
+	}
+
+	return true;
+}
+
+float ATopDownPlayer::GetGroundFootprintRadius() const
+{
+	if (GroundFootprint.bIsValid)
+	{
+		return GroundFootprint.GetRadius();
+	}
+
+	// Distance from the camera to the focus point, matching the offset used by DragMove
+	const float CameraDistance = SpringArm->TargetArmLength - SpringArm->SocketOffset.X;
+	const float Pitch = FMath::DegreesToRadians(FMath::Abs(SpringArm->GetRelativeRotation().Pitch));
+
+	const float HalfHorizontalFOV = FMath::DegreesToRadians(Camera->FieldOfView * 0.5f);
+	const float HalfVerticalFOV = FMath::Atan(FMath::Tan(HalfHorizontalFOV) / FMath::Max(Camera->AspectRatio, KINDA_SMALL_NUMBER));
+
+	// Law of sines on the camera / focus / far edge triangle; the far edge dominates the footprint
+	const float FarEdgeAngle = FMath::Max(Pitch - HalfVerticalFOV, KINDA_SMALL_NUMBER);
+	const float HalfDepth = CameraDistance * FMath::Sin(HalfVerticalFOV) / FMath::Sin(FarEdgeAngle);
+	const float HalfWidth = (CameraDistance + HalfDepth) * FMath::Tan(HalfHorizontalFOV);
+
+	return FMath::Sqrt(FMath::Square(HalfWidth) + FMath::Square(HalfDepth));
+}
+
+void ATopDownPlayer::Tick(float DeltaSeconds)
+{
+	SCOPE_CYCLE_COUNTER(STAT_TopDownPlayerTick);
+
+	Super::Tick(DeltaSeconds);
+
+	UpdateStreamingViewVelocity(DeltaSeconds);
+
+	if (bDragMovePending)
+	{
+		bDragMovePending = false;
+		ApplyDragMove();
+	}
+
+	if (bFollowingGroup)
+	{
+		UpdateGroupFollow(DeltaSeconds);
+	}
+
+	// Proxies and the server copies of remote pawns have no pointer, and would only project garbage
+	if (!IsLocallyControlled()) return;
+
+	if (InputSource)
+	{
+		InputSource->Update(DeltaSeconds);
+	}
+
+	MoveTracking();
+}
+
+void ATopDownPlayer::GetInputLatencyPercentiles(float& P50Ms, float& P99Ms) const
+{
+	InputLatency.GetPercentiles(P50Ms, P99Ms);
+}
+
+void ATopDownPlayer::ResetInputLatency()
+{
+	InputLatency.Reset();
+}
+
+const FTopDownViewProjection& ATopDownPlayer::GetViewProjection()
+{
+	if (!InputSource) return ViewProjection;
+
+	// Keyed on the view rather than the frame, so queries after the movement component moved the pawn see the new view
+	FMinimalViewInfo ViewInfo;
+	Camera->GetCameraView(0.0f, ViewInfo);
+	const FIntPoint ViewportSize = InputSource->GetViewportSize();
+
+	if (!ViewProjection.IsValid()
+		|| ViewportSize != ViewProjection.GetViewportSize()
+		|| ViewInfo.FOV != ViewProjectionFieldOfView
+		|| !ViewInfo.Location.Equals(ViewProjection.GetViewOrigin(), 0.01f)
+		|| !ViewInfo.Rotation.Equals(ViewProjectionRotation, 0.01f))
+	{
+		ViewProjection.Capture(ViewInfo, ViewportSize);
+		ViewProjectionRotation = ViewInfo.Rotation;
+		ViewProjectionFieldOfView = ViewInfo.FOV;
+	}
+
+	return ViewProjection;
+}
+
+void ATopDownPlayer::ProjectWorldLocationsToScreen(const TArray<FVector>& Locations, TArray<FVector2D>& OutScreenPositions, TArray<bool>& OutVisible)
+{
+	SCOPE_CYCLE_COUNTER(STAT_TopDownProjectWorldLocations);
+
+	const FTopDownViewProjection& Projection = GetViewProjection();
+
+	ScratchWorldPoints.Reset(Locations.Num(), Projection.GetViewOrigin());
+	for (const FVector& Location : Locations)
+	{
+		ScratchWorldPoints.Add(Location);
+	}
+
+	Projection.ProjectPoints(ScratchWorldPoints, ScratchScreenPoints);
+
+	OutScreenPositions.SetNumUninitialized(Locations.Num());
+	OutVisible.SetNumUninitialized(Locations.Num());
+	for (int32 Index = 0; Index < Locations.Num(); ++Index)
+	{
+		OutScreenPositions[Index] = FVector2D(ScratchScreenPoints.X[Index], ScratchScreenPoints.Y[Index]);
+		OutVisible[Index] = ScratchScreenPoints.Visible[Index] != 0;
+	}
+}
+
+int32 ATopDownPlayer::FindNearestLocationToCursor(const TArray<FVector>& Locations, float MaxScreenDistance)
+{
+	SCOPE_CYCLE_COUNTER(STAT_TopDownProjectWorldLocations);
+
+	if (!InputRoutines.GetPointerPosition) return INDEX_NONE;
+
+	// Only the screen position is needed, no ground projection. Devices without a pointer use the viewport center
+	FVector2D CursorScreenPos;
+	(this->*InputRoutines.GetPointerPosition)(CursorScreenPos);
+
+	const FTopDownViewProjection& Projection = GetViewProjection();
+
+	ScratchWorldPoints.Reset(Locations.Num(), Projection.GetViewOrigin());
+	for (const FVector& Location : Locations)
+	{
+		ScratchWorldPoints.Add(Location);
+	}
+
+	Projection.ProjectPoints(ScratchWorldPoints, ScratchScreenPoints);
+
+	return FTopDownViewProjection::FindNearestToScreenPosition(ScratchScreenPoints, CursorScreenPos, MaxScreenDistance);
+}
+
+void ATopDownPlayer::OnRootTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	// Only a movement component move following Move or edge scroll input consumes the sample.
+	// Server corrections teleport, and group follow, spin and drag offsets are flagged by bApplyingNonInputMove
+	if (bRecordInputLatency && bInputMovePending && !bApplyingNonInputMove && Teleport == ETeleportType::None)
+	{
+		bInputMovePending = false;
+		InputLatency.MarkCameraApplied();
+	}
 }
 
 void ATopDownPlayer::OverlapBegin(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
@@ -131,10 +670,61 @@ void ATopDownPlayer::OverlapEnd(UPrimitiveComponent* OverlappedComponent, AActor
 	}
 }
 
+void ATopDownPlayer::SetInputSource(UTopDownInputSource* NewInputSource)
+{
+	if (!NewInputSource) { UE_LOG(LogTemp, Warning, TEXT("SetInputSource InputSource is null")) return; }
+
+	InputSource = NewInputSource;
+	InputSource->Initialize(this);
+
+	// Sources without a controller never receive OnKeySwitch
+	if (InputSource->GetInitialInputType() != EInputType::Unknown)
+	{
+		HandleInputTypeSwitched(InputSource->GetInitialInputType());
+	}
+}
+
 void ATopDownPlayer::HandleInputTypeSwitched(EInputType NewInputType)
 {
 	//UE_LOG(LogTemp, Warning, TEXT("Input type switched to: %s"), *UEnum::GetValueAsString(NewInputType));
 	CurrentInputType = NewInputType;
+
+	switch (CurrentInputType)
+	{
+#if TOPDOWN_WITH_MOUSE
+	case EInputType::KeyMouse:
+
+		SelectInputRoutines<FTopDownMouseInputPolicy>();
+		break;
+#endif
+#if TOPDOWN_WITH_GAMEPAD
+	case EInputType::Gamepad:
+
+		SelectInputRoutines<FTopDownGamepadInputPolicy>();
+		break;
+#endif
+#if TOPDOWN_WITH_TOUCH
+	case EInputType::Touch:
+
+		SelectInputRoutines<FTopDownTouchInputPolicy>();
+		break;
+#endif
+	default:
+
+		SelectInputRoutines<FTopDownNoInputPolicy>();
+		break;
+	}
+}
+
+template<typename TInputPolicy>
+void ATopDownPlayer::SelectInputRoutines()
+{
+	InputRoutines.MoveTracking = &ATopDownPlayer::MoveTrackingImpl<TInputPolicy>;
+	InputRoutines.UpdateCursorPosition = &ATopDownPlayer::UpdateCursorPositionImpl<TInputPolicy>;
+	InputRoutines.PositionCheck = &ATopDownPlayer::PositionCheckImpl<TInputPolicy>;
+	InputRoutines.ProjectToGroundPlane = &ATopDownPlayer::ProjectToGroundPlaneImpl<TInputPolicy>;
+	InputRoutines.GetPointerPosition = &ATopDownPlayer::GetPointerPositionImpl<TInputPolicy>;
+	InputRoutines.CursorDistFromCenter = &ATopDownPlayer::CursorDistFromCenterImpl<TInputPolicy>;
 }
 
 void ATopDownPlayer::Move(const FInputActionValue& Value)
@@ -143,6 +733,14 @@ void ATopDownPlayer::Move(const FInputActionValue& Value)
 	
 	if (Controller && (DirectionValue != FVector2D(0.f)))
 	{
+		StopGroupFollow();
+
+		if (bRecordInputLatency)
+		{
+			InputLatency.MarkInputSample();
+			bInputMovePending = true;
+		}
+
 		FVector ForwardVector = GetActorForwardVector();
 		AddMovementInput(ForwardVector, DirectionValue.Y);
 		FVector RightVector = GetActorRightVector();
@@ -153,6 +751,8 @@ void ATopDownPlayer::Move(const FInputActionValue& Value)
 void ATopDownPlayer::Spin(const FInputActionValue& Value)
 {
 	const float RotationValue = Value.Get<float>();
+
+	TGuardValue<bool> NonInputMoveGuard(bApplyingNonInputMove, true);
 	AddActorLocalRotation(FRotator(0.0f, RotationValue, 0.0f));
 }
 
@@ -160,145 +760,509 @@ void ATopDownPlayer::Zoom(const FInputActionValue& Value)
 {
 	ZoomDirection = Value.Get<float>();
 
+	if (ZoomDirection != 0.f)
+	{
+		StopGroupFollow();
+	}
+
 	DepthOfField();
 	UpdateZoom();
 }
 
 void ATopDownPlayer::DragMove()
+{
+	// Applied in Tick so the pointer is sampled as late as possible in the frame
+	bDragMovePending = true;
+
+	if (bRecordInputLatency)
+	{
+		InputLatency.MarkInputSample();
+	}
+}
+
+void ATopDownPlayer::ApplyDragMove()
+{
+	StopGroupFollow();
+
+	SingleTouchCheck(PlayerController);
+
+	const FVector SpringArmForward = SpringArm->GetForwardVector();
+	const FVector SpringArmUp = SpringArm->GetUpVector();
+	const float ArmLength = SpringArm->TargetArmLength;
+	const float OffsetX = SpringArm->SocketOffset.X;
+	const float OffsetZ = SpringArm->SocketOffset.Z;
+
+	const FVector BackwardOffset = SpringArmForward * (ArmLength - OffsetX) * -1.0f;
+	const FVector VerticalOffset = SpringArmUp * OffsetZ;
+	const FVector CameraOffset = SpringArm->GetComponentLocation() + BackwardOffset + VerticalOffset;
+
+	const FVector RelativeToCamera = CameraOffset - Camera->GetComponentLocation();
+	FVector2D ScreenPos;
+	FVector Intersection;
+	bool bProjectionSuccess = ProjectToGroundPlane(PlayerController, ScreenPos, Intersection);
+
+	if (bProjectionSuccess)
+	{
+		const FVector WorldDelta = TargetHandle - Intersection - RelativeToCamera;
+		{
+			TGuardValue<bool> NonInputMoveGuard(bApplyingNonInputMove, true);
+			AddActorWorldOffset(FVector(WorldDelta.X, WorldDelta.Y, 0.0f));
+		}
+
+		// The offset is the drag input itself, it does not go through the movement component
+		if (bRecordInputLatency)
+		{
+			InputLatency.MarkCameraApplied();
+		}
+	}
+	else
+	{
+		if (!PlayerController) { UE_LOG(LogTemp, Warning, TEXT("DragMove Main PlayerController was not initialized")) return; }
+
+		if (TObjectPtr<UEnhancedInputLocalPlayerSubsystem> Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PlayerController->GetLocalPlayer()))
+		{
+			FModifyContextOptions Options;
+			Options.bForceImmediately = true;
+			Options.bNotifyUserSettings = false;
+			Options.bIgnoreAllPressedKeysUntilRelease = true;
+
+			Subsystem->RemoveMappingContext(DragMoveMappingContext.Get(), Options);
+		}
+	}
+}
+
+void ATopDownPlayer::CursorMove(const FInputActionValue& Value)
+{
+	VirtualCursorInput = Value.Get<FVector2D>();
+}
+
+void ATopDownPlayer::SelectStarted()
 {
 	SingleTouchCheck(PlayerController);
 
-	const FVector SpringArmForward = SpringArm->GetForwardVector();
-	const FVector SpringArmUp = SpringArm->GetUpVector();
-	const float ArmLength = SpringArm->TargetArmLength;
-	const float OffsetX = SpringArm->SocketOffset.X;
-	const float OffsetZ = SpringArm->SocketOffset.Z;
+	PositionCheck();
+
+	if (CollisionOverlapCheck())
+	{
+		HandleSelection();
+	}
+	else
+	{
+		if (!PlayerController) { UE_LOG(LogTemp, Warning, TEXT("SelectStarted Main PlayerController was not initialized")) return; }
+
+		if (TObjectPtr<UEnhancedInputLocalPlayerSubsystem> Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PlayerController->GetLocalPlayer()))
+		{
+			Subsystem->AddMappingContext(DragMoveMappingContext.Get(), 0);
+		}
+	}
+}
+
+void ATopDownPlayer::SelectStopped()
+{
+	if (!PlayerController) { UE_LOG(LogTemp, Warning, TEXT("SelectStopped Main PlayerController was not initialized")) return; }
+
+	if (TObjectPtr<UEnhancedInputLocalPlayerSubsystem> Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PlayerController->GetLocalPlayer()))
+	{
+		FModifyContextOptions Options;
+		Options.bForceImmediately = true;
+		Options.bNotifyUserSettings = false;
+		Options.bIgnoreAllPressedKeysUntilRelease = true;
+
+		Subsystem->RemoveMappingContext(DragMoveMappingContext.Get(), Options);
+	}
+}
+
+void ATopDownPlayer::HandleSelection()
+{
+
+}
+
+void ATopDownPlayer::SimulateAction(ETopDownSimulatedAction Action, ETriggerEvent TriggerEvent)
+{
+	switch (Action)
+	{
+	case ETopDownSimulatedAction::Select:
+
+		if (TriggerEvent == ETriggerEvent::Started)
+		{
+			// Same flow as SelectStarted, with the selection made here since HandleSelection is left to the project
+			// and the drag tracked here since there is no drag mapping context to add
+			PositionCheck();
+
+			TArray<AActor*> SelectedActors;
+			if (SelectionSubsystem)
+			{
+				SelectionSubsystem->FindSelectablesInRadius(CollisionSphere->GetComponentLocation(), CollisionSphere->GetScaledSphereRadius(), SelectedActors);
+			}
+
+			bSimulatedDragActive = SelectedActors.Num() == 0;
+			if (!bSimulatedDragActive)
+			{
+				SelectionSubsystem->SetSelection(SelectedActors);
+				HandleSelection();
+			}
+		}
+		else if (TriggerEvent == ETriggerEvent::Triggered)
+		{
+			if (bSimulatedDragActive)
+			{
+				DragMove();
+			}
+		}
+		else
+		{
+			bSimulatedDragActive = false;
+		}
+		break;
+
+	case ETopDownSimulatedAction::Command:
+
+		if (TriggerEvent == ETriggerEvent::Started)
+		{
+			IssueMoveCommand();
+		}
+		break;
+
+	case ETopDownSimulatedAction::ZoomIn:
+	case ETopDownSimulatedAction::ZoomOut:
+
+		if (TriggerEvent == ETriggerEvent::Triggered)
+		{
+			Zoom(FInputActionValue(Action == ETopDownSimulatedAction::ZoomIn ? -1.0f : 1.0f));
+		}
+		else if (TriggerEvent == ETriggerEvent::Completed)
+		{
+			ZoomDirection = 0.f;
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+void ATopDownPlayer::StartGroupFollow(const TArray<AActor*>& Units)
+{
+	if (!SelectionSubsystem) { UE_LOG(LogTemp, Warning, TEXT("StartGroupFollow SelectionSubsystem was not initialized")) return; }
+
+	StopGroupFollow();
+
+	for (const AActor* Unit : Units)
+	{
+		FVector UnitLocation;
+		if (!FollowedGroup.Contains(Unit) && SelectionSubsystem->GetSelectableLocation(Unit, UnitLocation))
+		{
+			FollowedGroup.Add(Unit, UnitLocation);
+
+			// Only the followed units, the rest of the world moving costs nothing
+			FollowedUnitMovedHandles.Add(Unit, SelectionSubsystem->AddSelectableMovedListener(Unit,
+				FOnSelectableMovedSignature::FDelegate::CreateUObject(this, &ATopDownPlayer::OnFollowedUnitMoved)));
+		}
+	}
+
+	if (FollowedGroup.IsEmpty()) return;
+
+	FollowedUnitUnregisteredHandle = SelectionSubsystem->OnSelectableUnregistered.AddUObject(this, &ATopDownPlayer::OnFollowedUnitUnregistered);
+	bFollowingGroup = true;
+}
+
+void ATopDownPlayer::FollowSelection()
+{
+	if (!SelectionSubsystem) { UE_LOG(LogTemp, Warning, TEXT("FollowSelection SelectionSubsystem was not initialized")) return; }
+
+	StartGroupFollow(TArray<AActor*>(SelectionSubsystem->GetSelection()));
+}
+
+void ATopDownPlayer::StopGroupFollow()
+{
+	if (!bFollowingGroup) return;
+
+	if (SelectionSubsystem)
+	{
+		for (const TPair<TObjectKey<AActor>, FDelegateHandle>& Pair : FollowedUnitMovedHandles)
+		{
+			SelectionSubsystem->RemoveSelectableMovedListener(Pair.Key.ResolveObjectPtr(), Pair.Value);
+		}
+		SelectionSubsystem->OnSelectableUnregistered.Remove(FollowedUnitUnregisteredHandle);
+	}
+
+	FollowedUnitMovedHandles.Reset();
+	FollowedUnitUnregisteredHandle.Reset();
+	FollowedGroup.Reset();
+	bFollowingGroup = false;
+}
+
+void ATopDownPlayer::OnFollowedUnitMoved(AActor* Unit, const FVector& OldLocation, const FVector& NewLocation)
+{
+	FollowedGroup.Move(Unit, NewLocation);
+}
+
+void ATopDownPlayer::OnFollowedUnitUnregistered(AActor* Unit)
+{
+	// The subsystem already dropped the unit's listeners
+	FollowedUnitMovedHandles.Remove(Unit);
+	FollowedGroup.Remove(Unit);
+}
+
+void ATopDownPlayer::UpdateGroupFollow(float DeltaSeconds)
+{
+	if (FollowedGroup.IsEmpty())
+	{
+		StopGroupFollow();
+		return;
+	}
+
+	const FVector2D Centroid = FollowedGroup.GetCentroid();
+
+	// The view center and the pawn are a fixed offset apart, so moving the pawn moves the view center by the same amount
+	const FVector ViewCenter = GroundFootprint.bIsValid ? GroundFootprint.Center : GetActorLocation();
+	const FVector2D ViewOffset = Centroid - FVector2D(ViewCenter);
+	const float FollowAlpha = 1.f - FMath::Exp(-GroupFollowSpeed * DeltaSeconds);
+	{
+		TGuardValue<bool> NonInputMoveGuard(bApplyingNonInputMove, true);
+		AddActorWorldOffset(FVector(ViewOffset * FollowAlpha, 0.0f));
+	}
+
+	if (!GroundFootprint.bIsValid) return;
+
+	// The group bounds as they will be framed once centered, grown by the share of the footprint they may take.
+	// Tested against the footprint quad itself, the near edge of a pitched camera sees much less ground than its radius
+	const FBox2D GroupBounds = FollowedGroup.GetBounds();
+	const FVector2D FramedOffset = FVector2D(GroundFootprint.Center) - Centroid;
+	auto GetFramedBounds = [&](float Scale)
+	{
+		return FBox2D(Centroid + (GroupBounds.Min - Centroid) * Scale + FramedOffset, Centroid + (GroupBounds.Max - Centroid) * Scale + FramedOffset);
+	};
+
+	// Zoom out when the group outgrows its share of the footprint, zoom back in once it fits with the tolerance to spare
+	float ZoomDirection = 0.f;
+	if (!GroundFootprint.ContainsBox(GetFramedBounds(1.f / GroupFollowFill)))
+	{
+		ZoomDirection = 1.f;
+	}
+	else if (GroundFootprint.ContainsBox(GetFramedBounds((1.f + GroupFollowZoomTolerance) / GroupFollowFill)))
+	{
+		ZoomDirection = -1.f;
+	}
+
+	if (ZoomDirection == 0.f) return;
+
+	const float NewZoomValue = FMath::Clamp(ZoomValue + ZoomDirection * GroupFollowZoomSpeed * DeltaSeconds, 0.f, 1.f);
+	if (NewZoomValue != ZoomValue)
+	{
+		ZoomValue = NewZoomValue;
+		ApplyZoom();
+	}
+}
+
+void ATopDownPlayer::IssueMoveCommand()
+{
+	if (!SelectionSubsystem || SelectionSubsystem->GetSelection().Num() == 0) return;
+
+	UTopDownCommandSubsystem* CommandSubsystem = GetWorld()->GetSubsystem<UTopDownCommandSubsystem>();
+	if (!CommandSubsystem) { UE_LOG(LogTemp, Warning, TEXT("IssueMoveCommand CommandSubsystem is not available")) return; }
+
+	PositionCheck();
+
+	CommandSubsystem->IssueMoveCommand(TArray<AActor*>(SelectionSubsystem->GetSelection()), TargetHandle);
+}
+
+void ATopDownPlayer::MoveTracking()
+{
+	(this->*InputRoutines.MoveTracking)();
+}
+
+template<typename TInputPolicy>
+void ATopDownPlayer::MoveTrackingImpl()
+{
+	if (!InputSource) { UE_LOG(LogTemp, Warning, TEXT("MoveTracking InputSource was not initialized")) return; }
+
+	FVector CurrentPosition = GetActorLocation();
+
+	// Calculate how far the player is from the origin (0,0,0)
+	// Start applying movement only when distance exceeds 'PullStartDistance' units
+	// The further out past PullStartDistance the stronger the movement (max value not clamped)
+	float ScaleValue = CurrentPosition.Size() - PullStartDistance;
+	ScaleValue = ScaleValue / 5000.f;
+	ScaleValue = FMath::Max(ScaleValue, 0.f);
+
+	// Flip the direction to point *toward* the origin instead of away from it
+	// Also ensure movement is flat by zeroing out the Z axis
+	FVector CurrentDirection = CurrentPosition.GetSafeNormal(0.0001f);
+	CurrentDirection = UKismetMathLibrary::Multiply_VectorInt(FVector(CurrentDirection.X, CurrentDirection.Y, 0.0), -1);
+
+	// The group follow owns the camera position, neither the pull nor edge scrolling apply meanwhile
+	if (!bFollowingGroup)
+	{
+		AddMovementInput(CurrentDirection, ScaleValue);
+	}
 
-	const FVector BackwardOffset = SpringArmForward * (ArmLength - OffsetX) * -1.0f;
-	const FVector VerticalOffset = SpringArmUp * OffsetZ;
-	const FVector CameraOffset = SpringArm->GetComponentLocation() + BackwardOffset + VerticalOffset;
+	if constexpr (TInputPolicy::InputType == EInputType::Gamepad)
+	{
+		UpdateVirtualCursor(GetWorld()->GetDeltaSeconds());
+	}
 
-	const FVector RelativeToCamera = CameraOffset - Camera->GetComponentLocation();
+	// The projection is shared by edge scrolling and the collision sphere placement
 	FVector2D ScreenPos;
 	FVector Intersection;
-	bool bProjectionSuccess = ProjectToGroundPlane(PlayerController, ScreenPos, Intersection);
+	bool bGotPointerPos;
+	const bool bDeprojected = DeprojectPointerImpl<TInputPolicy>(ScreenPos, Intersection, bGotPointerPos);
+	const bool bProjectionSuccess = bDeprojected && bGotPointerPos;
 
-	if (bProjectionSuccess)
+	FVector Direction;
+	float Strength;
+	EdgeMoveImpl<TInputPolicy>(ScreenPos, Direction, Strength);
+
+	const bool bEdgeScrolling = !bFollowingGroup && !Direction.IsNearlyZero();
+	if (bEdgeScrolling)
 	{
-		const FVector WorldDelta = TargetHandle - Intersection - RelativeToCamera;
-		AddActorWorldOffset(FVector(WorldDelta.X, WorldDelta.Y, 0.0f));
+		AddMovementInput(Direction, Strength);
 	}
-	else
+
+	// Only the pointer reaching the edge is an input sample, holding it there is not
+	if (bRecordInputLatency && bEdgeScrolling && !bWasEdgeScrolling)
 	{
-		if (!PlayerController) { UE_LOG(LogTemp, Warning, TEXT("DragMove Main PlayerController was not initialized")) return; }
+		InputLatency.MarkInputSample();
+		bInputMovePending = true;
+	}
+	bWasEdgeScrolling = bEdgeScrolling;
 
-		if (TObjectPtr<UEnhancedInputLocalPlayerSubsystem> Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PlayerController->GetLocalPlayer()))
+	// Without a ground point the sphere and cursor keep their last placement
+	if (bDeprojected)
+	{
+		if constexpr (TInputPolicy::bIsTouch)
 		{
-			FModifyContextOptions Options;
-			Options.bForceImmediately = true;
-			Options.bNotifyUserSettings = false;
-			Options.bIgnoreAllPressedKeysUntilRelease = true;
+			FVector CollisionLocation = CollisionSphere->GetComponentLocation();
+			float DeltaSeconds = GetWorld()->GetDeltaSeconds();
+			FVector InterpolatedLocation = UKismetMathLibrary::VInterpTo(CollisionLocation, FVector(CollisionLocation.X, CollisionLocation.Y, -500.f), DeltaSeconds, 12.f);
+			FVector TouchInterpolatedLocation = UKismetMathLibrary::SelectVector(Intersection, InterpolatedLocation, bProjectionSuccess);
 
-			Subsystem->RemoveMappingContext(DragMoveMappingContext, Options);
+			CollisionSphere->SetWorldLocation(TouchInterpolatedLocation);
+		}
+		else
+		{
+			CollisionSphere->SetWorldLocation(Intersection + FVector(0.0f, 0.0f, 10.f));
 		}
+
+		UpdateCursorPositionImpl<TInputPolicy>();
 	}
 }
 
-void ATopDownPlayer::SelectStarted()
+void ATopDownPlayer::PostMovementTick(float DeltaSeconds)
 {
-	SingleTouchCheck(PlayerController);
+	// Same as the input path in Tick, only the local view has a footprint
+	if (!IsLocallyControlled()) return;
 
-	PositionCheck();
+	UpdateGroundFootprint();
 
-	if (CollisionOverlapCheck())
+	if (SignificanceSubsystem && PlayerController && PlayerController->IsLocalController())
 	{
-		HandleSelection();
+		FTopDownCameraFocus CameraFocus;
+		CameraFocus.ViewCenter = GroundFootprint.bIsValid ? GroundFootprint.Center : GetActorLocation();
+		CameraFocus.CursorLocation = CollisionSphere->GetComponentLocation();
+		CameraFocus.TargetHandle = TargetHandle;
+		CameraFocus.FootprintRadius = GetGroundFootprintRadius();
+		CameraFocus.ZoomValue = ZoomValue;
+
+		SignificanceSubsystem->PublishCameraFocus(CameraFocus);
 	}
-	else
-	{
-		if (!PlayerController) { UE_LOG(LogTemp, Warning, TEXT("SelectStarted Main PlayerController was not initialized")) return; }
 
-		if (TObjectPtr<UEnhancedInputLocalPlayerSubsystem> Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PlayerController->GetLocalPlayer()))
-		{
-			Subsystem->AddMappingContext(DragMoveMappingContext, 0);
-		}
-	}
+	UpdateCameraInterest();
 }
 
-void ATopDownPlayer::SelectStopped()
+void FTopDownPostMovementTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRefPtr& MyCompletionGraphEvent)
 {
-	if (!PlayerController) { UE_LOG(LogTemp, Warning, TEXT("SelectStopped Main PlayerController was not initialized")) return; }
-
-	if (TObjectPtr<UEnhancedInputLocalPlayerSubsystem> Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PlayerController->GetLocalPlayer()))
+	if (IsValid(Target) && TickType != LEVELTICK_ViewportsOnly)
 	{
-		FModifyContextOptions Options;
-		Options.bForceImmediately = true;
-		Options.bNotifyUserSettings = false;
-		Options.bIgnoreAllPressedKeysUntilRelease = true;
-
-		Subsystem->RemoveMappingContext(DragMoveMappingContext, Options);
+		FScopeCycleCounterUObject ActorScope(Target);
+		Target->PostMovementTick(DeltaTime * Target->CustomTimeDilation);
 	}
 }
 
-void ATopDownPlayer::HandleSelection()
+FString FTopDownPostMovementTickFunction::DiagnosticMessage()
 {
+	return Target ? Target->GetFullName() + TEXT("[PostMovementTick]") : TEXT("<null>[PostMovementTick]");
+}
 
+FName FTopDownPostMovementTickFunction::DiagnosticContext(bool bDetailed)
+{
+	return Target ? Target->GetClass()->GetFName() : NAME_None;
 }
 
-void ATopDownPlayer::MoveTracking()
+void ATopDownPlayer::UpdateCameraInterest()
 {
-	if (!PlayerController) { UE_LOG(LogTemp, Warning, TEXT("MoveTracking Main PlayerController was not initialized")) return; }
+	if (!GroundFootprint.bIsValid || !IsLocallyControlled()) return;
 
-	FVector CurrentPosition = GetActorLocation();
+	// Players only send it when there is a server, bots always publish so load tests exercise the relevancy path
+	const bool bSynthetic = InputSource && InputSource->IsSynthetic();
+	if (!bSynthetic && (GetNetMode() == NM_Standalone || !IsPlayerControlled())) return;
 
-	// Calculate how far the player is from the origin (0,0,0)
-	// Start applying movement only when distance exceeds 'PullStartDistance' units
-	// The further out past PullStartDistance the stronger the movement (max value not clamped)
-	float ScaleValue = CurrentPosition.Size() - PullStartDistance;
-	ScaleValue = ScaleValue / 5000.f;
-	ScaleValue = FMath::Max(ScaleValue, 0.f);
+	const double CurrentTime = GetWorld()->GetTimeSeconds();
+	const double TimeSinceSent = CurrentTime - LastCameraInterestTime;
+	if (bCameraInterestSent && TimeSinceSent < CameraInterestInterval) return;
 
-	// Flip the direction to point *toward* the origin instead of away from it
-	// Also ensure movement is flat by zeroing out the Z axis
-	FVector CurrentDirection = CurrentPosition.GetSafeNormal(0.0001f);
-	CurrentDirection = UKismetMathLibrary::Multiply_VectorInt(FVector(CurrentDirection.X, CurrentDirection.Y, 0.0), -1);
+	FTopDownCameraInterest Interest;
+	Interest.Focus = GroundFootprint.Center;
+	Interest.BoundsMin = FVector(GroundFootprint.Bounds.Min, 0.0f);
+	Interest.BoundsMax = FVector(GroundFootprint.Bounds.Max, 0.0f);
 
-	AddMovementInput(CurrentDirection, ScaleValue);
+	// The RPC is unreliable, an unchanged interest is still resent every second in case the last one was dropped
+	if (bCameraInterestSent && TimeSinceSent < 1.0 && Interest.Equals(SentCameraInterest, CameraInterestTolerance)) return;
 
-	FVector Direction;
-	float Strength;
-	EdgeMove(PlayerController, Direction, Strength);
+	SentCameraInterest = Interest;
+	LastCameraInterestTime = CurrentTime;
+	bCameraInterestSent = true;
 
-	AddMovementInput(Direction, Strength);
+	ServerUpdateCameraInterest(Interest);
+}
 
-	FVector2D ScreenPos;
-	FVector Intersection;
+void ATopDownPlayer::ServerUpdateCameraInterest_Implementation(const FTopDownCameraInterest& Interest)
+{
+	// Relevancy is evaluated per connection, keyed by the player controller
+	AActor* Viewer = GetController();
+	if (!Viewer) return;
 
-	bool bProjectionSuccess = ProjectToGroundPlane(PlayerController, ScreenPos, Intersection);
-	FVector CollisionLocation = CollisionSphere->GetComponentLocation();
-	float DeltaSeconds = GetWorld()->GetDeltaSeconds();
-	FVector InterpolatedLocation = UKismetMathLibrary::VInterpTo(CollisionLocation, FVector(CollisionLocation.X, CollisionLocation.Y, -500.f), DeltaSeconds, 12.f);
-	FVector TouchInterpolatedLocation = UKismetMathLibrary::SelectVector(Intersection, InterpolatedLocation, bProjectionSuccess);
+	UTopDownRelevancySubsystem* RelevancySubsystem = GetWorld()->GetSubsystem<UTopDownRelevancySubsystem>();
+	if (!RelevancySubsystem) return;
 
-	if (CurrentInputType == EInputType::Touch)
+	if (CameraInterestViewer.IsValid() && CameraInterestViewer.Get() != Viewer)
 	{
-		CollisionSphere->SetWorldLocation(TouchInterpolatedLocation);
+		RelevancySubsystem->RemoveViewer(CameraInterestViewer.Get());
 	}
-	else
+	CameraInterestViewer = Viewer;
+
+	RelevancySubsystem->SetViewerInterest(Viewer, Interest);
+}
+
+void ATopDownPlayer::RemoveCameraInterestViewer()
+{
+	if (AActor* Viewer = CameraInterestViewer.Get())
 	{
-		CollisionSphere->SetWorldLocation(Intersection + FVector(0.0f, 0.0f, 10.f));
+		if (UTopDownRelevancySubsystem* RelevancySubsystem = GetWorld()->GetSubsystem<UTopDownRelevancySubsystem>())
+		{
+			RelevancySubsystem->RemoveViewer(Viewer);
+		}
 	}
+	CameraInterestViewer.Reset();
 
-	UpdateCursorPosition();
+	// A new controller gets the interest right away instead of after the resend interval
+	bCameraInterestSent = false;
 }
 
 void ATopDownPlayer::UpdateZoom()
 {
 	ZoomValue = FMath::Clamp(ZoomValue + ZoomDirection * ZoomSpeed, 0.f, 1.f);
 
-	if (!ZoomCurve) return;
+	ApplyZoom();
+}
+
+void ATopDownPlayer::ApplyZoom()
+{
+	// Reapplied by OnAssetsLoaded once the curve is streamed in
+	const UCurveFloat* LoadedZoomCurve = ZoomCurve.Get();
+	if (!LoadedZoomCurve) return;
 
-	float ZoomCurveValue = ZoomCurve->GetFloatValue(ZoomValue);
+	float ZoomCurveValue = LoadedZoomCurve->GetFloatValue(ZoomValue);
 
 	SpringArm->TargetArmLength = UKismetMathLibrary::Lerp(800.f, 40000.f, ZoomCurveValue);
 	SpringArm->SetRelativeRotation(FRotator(UKismetMathLibrary::Lerp(-40.f, -55.f, ZoomCurveValue), 0.0f, 0.0f));
@@ -309,18 +1273,25 @@ void ATopDownPlayer::UpdateZoom()
 }
 
 void ATopDownPlayer::UpdateCursorPosition()
+{
+	(this->*InputRoutines.UpdateCursorPosition)();
+}
+
+template<typename TInputPolicy>
+void ATopDownPlayer::UpdateCursorPositionImpl()
 {
 
 	FTransform TargetTransform;
 	float DeltaSeconds = GetWorld()->GetDeltaSeconds();
-	if (CurrentInputType == EInputType::Touch)
+	if constexpr (TInputPolicy::bIsTouch)
 	{
 
 		FVector TargetLocation = FVector(0.f, 0.f, -100.f);
 		FVector2D ScreenPos;
 		FVector Intersection;
+		bool bProjectionSuccess;
 
-		bool bProjectionSuccess = ProjectToGroundPlane(PlayerController, ScreenPos, Intersection);
+		if (!DeprojectPointerImpl<TInputPolicy>(ScreenPos, Intersection, bProjectionSuccess)) return;
 
 		if (!bProjectionSuccess)
 		{
@@ -362,18 +1333,222 @@ void ATopDownPlayer::UpdateCursorPosition()
 }
 
 void ATopDownPlayer::PositionCheck()
+{
+	(this->*InputRoutines.PositionCheck)();
+}
+
+template<typename TInputPolicy>
+void ATopDownPlayer::PositionCheckImpl()
 {
 	FVector2D ScreenPos;
 	FVector Intersection;
-	ProjectToGroundPlane(PlayerController, ScreenPos, Intersection);
+	bool bGotPointerPos;
+
+	// Keep the previous handle rather than grabbing an undefined point
+	if (!DeprojectPointerImpl<TInputPolicy>(ScreenPos, Intersection, bGotPointerPos)) return;
 
 	TargetHandle = Intersection;
-	if (CurrentInputType == EInputType::Touch)
+	if constexpr (TInputPolicy::bIsTouch)
 	{
 		CollisionSphere->SetWorldLocation(TargetHandle);
 	}
 }
 
+void ATopDownPlayer::UpdateVirtualCursor(float DeltaSeconds)
+{
+	const FVector2D ViewportSize(InputSource->GetViewportSize());
+
+	if (VirtualCursorPosition.X < 0.0f)
+	{
+		VirtualCursorPosition = ViewportSize * 0.5f;
+	}
+
+	FVector2D SnapScreenPos;
+	AActor* SnapTarget = bEnableAimAssist ? FindSnapTarget(VirtualCursorPosition, SnapScreenPos) : nullptr;
+	VirtualCursorSnapTarget = SnapTarget;
+
+	const float Deflection = FMath::Min(VirtualCursorInput.Size(), 1.0f);
+	if (Deflection > KINDA_SMALL_NUMBER)
+	{
+		VirtualCursorHoldTime += DeltaSeconds;
+
+		const UCurveFloat* AccelerationCurve = VirtualCursorAccelerationCurve.Get();
+		const float DeflectionScale = AccelerationCurve ? AccelerationCurve->GetFloatValue(Deflection) : FMath::Square(Deflection);
+		const float RampAlpha = VirtualCursorRampTime > 0.0f ? FMath::Clamp(VirtualCursorHoldTime / VirtualCursorRampTime, 0.0f, 1.0f) : 1.0f;
+		const float RampScale = FMath::Lerp(VirtualCursorInitialSpeedScale, 1.0f, RampAlpha);
+		const float FrictionScale = SnapTarget ? VirtualCursorSnapFriction : 1.0f;
+
+		// Stick up is positive Y, screen up is negative Y
+		const FVector2D StickDirection = FVector2D(VirtualCursorInput.X, -VirtualCursorInput.Y).GetSafeNormal();
+		VirtualCursorPosition += StickDirection * VirtualCursorSpeed * DeflectionScale * RampScale * FrictionScale * DeltaSeconds;
+	}
+	else
+	{
+		VirtualCursorHoldTime = 0.0f;
+
+		if (SnapTarget)
+		{
+			VirtualCursorPosition = FMath::Vector2DInterpTo(VirtualCursorPosition, SnapScreenPos, DeltaSeconds, VirtualCursorSnapSpeed);
+		}
+	}
+
+	VirtualCursorPosition.X = FMath::Clamp(VirtualCursorPosition.X, 0.0f, ViewportSize.X);
+	VirtualCursorPosition.Y = FMath::Clamp(VirtualCursorPosition.Y, 0.0f, ViewportSize.Y);
+}
+
+AActor* ATopDownPlayer::FindSnapTarget(const FVector2D& ScreenPos, FVector2D& OutTargetScreenPos, bool* bOutBudgetExhausted)
+{
+	SCOPE_CYCLE_COUNTER(STAT_TopDownSnapQuery);
+
+	if (bOutBudgetExhausted)
+	{
+		*bOutBudgetExhausted = false;
+	}
+
+	if (!SelectionSubsystem || SelectionSubsystem->GetNumSelectables() == 0) return nullptr;
+
+	// Convert the screen radius to a ground radius around the cursor, the camera pitch stretches the vertical axis
+	FVector CursorGround, HorizontalGround, VerticalGround;
+	if (!DeprojectScreenToGround(ScreenPos, CursorGround)
+		|| !DeprojectScreenToGround(ScreenPos + FVector2D(VirtualCursorSnapRadius, 0.0f), HorizontalGround)
+		|| !DeprojectScreenToGround(ScreenPos - FVector2D(0.0f, VirtualCursorSnapRadius), VerticalGround))
+	{
+		return nullptr;
+	}
+
+	const float GroundRadius = FMath::Max(FVector::Dist2D(CursorGround, HorizontalGround), FVector::Dist2D(CursorGround, VerticalGround));
+
+	const FTopDownViewProjection& Projection = GetViewProjection();
+	const uint64 BudgetCycles = static_cast<uint64>(VirtualCursorSnapBudgetMs / (FPlatformTime::GetSecondsPerCycle64() * 1000.0));
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	AActor* NearestActor = nullptr;
+	float NearestDistanceSquared = FMath::Square(VirtualCursorSnapRadius);
+	int32 NumVisited = 0;
+
+	SelectionSubsystem->GetSelectableGrid().ForEachInRadius(FVector2D(CursorGround), GroundRadius, [&](const TTopDownSpatialGrid<TWeakObjectPtr<AActor>>::FEntry& Entry)
+	{
+		FVector2D CandidateScreenPos;
+		if (Projection.ProjectWorldToScreen(Entry.Location, CandidateScreenPos))
+		{
+			const float DistanceSquared = FVector2D::DistSquared(CandidateScreenPos, ScreenPos);
+			if (DistanceSquared <= NearestDistanceSquared)
+			{
+				if (AActor* Candidate = Entry.Element.Get())
+				{
+					NearestActor = Candidate;
+					NearestDistanceSquared = DistanceSquared;
+					OutTargetScreenPos = CandidateScreenPos;
+				}
+			}
+		}
+
+		// Reading the cycle counter is not free, only check the budget every few candidates
+		if ((++NumVisited % 32 != 0) || (FPlatformTime::Cycles64() - StartCycles < BudgetCycles)) return true;
+
+		INC_DWORD_STAT(STAT_TopDownSnapBudgetExhausted);
+		if (bOutBudgetExhausted)
+		{
+			*bOutBudgetExhausted = true;
+		}
+		return false;
+	});
+
+	return NearestActor;
+}
+
+bool ATopDownPlayer::DeprojectScreenToGround(const FVector2D& ScreenPos, FVector& OutGroundLocation) const
+{
+	if (!InputSource) return false;
+
+	FVector WorldOrigin, WorldDirection;
+	if (!InputSource->DeprojectScreenToWorld(ScreenPos, WorldOrigin, WorldDirection))
+	{
+		return false;
+	}
+
+	OutGroundLocation = IntersectGroundPlane(WorldOrigin, WorldDirection);
+	return true;
+}
+
+FVector ATopDownPlayer::IntersectGroundPlane(const FVector& WorldOrigin, const FVector& WorldDirection)
+{
+	// Same ray length as ProjectToGroundPlane, positions above the horizon are clamped to the end of the ray
+	const FVector LineEnd = WorldOrigin + (WorldDirection * 1000000.f);
+	const FPlane Plane = UKismetMathLibrary::MakePlaneFromPointAndNormal(FVector::ZeroVector, FVector(0.0f, 0.0f, 1.0f));
+
+	float TValue;
+	FVector GroundLocation;
+	if (!UKismetMathLibrary::LinePlaneIntersection(WorldOrigin, LineEnd, Plane, TValue, GroundLocation))
+	{
+		GroundLocation = FVector(LineEnd.X, LineEnd.Y, 0.0f);
+	}
+
+	return GroundLocation;
+}
+
+TArray<FVector> ATopDownPlayer::GetGroundFootprintCorners() const
+{
+	return TArray<FVector>(GroundFootprint.Corners, UE_ARRAY_COUNT(GroundFootprint.Corners));
+}
+
+void ATopDownPlayer::UpdateGroundFootprint()
+{
+	SCOPE_CYCLE_COUNTER(STAT_TopDownUpdateGroundFootprint);
+
+	// Remote controllers have no viewport, so only the local view is tracked
+	if (!InputSource) return;
+
+	const FIntPoint ViewportSize = InputSource->GetViewportSize();
+	if (ViewportSize.X <= 0 || ViewportSize.Y <= 0) return;
+
+	// The footprint is deprojected from the camera component's own view, which is also what the cache is keyed on.
+	// The controller's POV would only be refreshed by the camera manager later in the frame.
+	FMinimalViewInfo ViewInfo;
+	Camera->GetCameraView(0.0f, ViewInfo);
+
+	if (GroundFootprint.bIsValid
+		&& ViewportSize == FootprintViewportSize
+		&& ViewInfo.FOV == FootprintFieldOfView
+		&& ViewInfo.Location.Equals(FootprintViewLocation, 0.01f)
+		&& ViewInfo.Rotation.Equals(FootprintViewRotation, 0.01f))
+	{
+		return;
+	}
+
+	FTopDownViewProjection FootprintProjection;
+	FootprintProjection.Capture(ViewInfo, ViewportSize);
+
+	const FVector2D ScreenCorners[4] = {
+		FVector2D(0.0f, 0.0f),
+		FVector2D(ViewportSize.X, 0.0f),
+		FVector2D(ViewportSize.X, ViewportSize.Y),
+		FVector2D(0.0f, ViewportSize.Y)
+	};
+
+	for (int32 Index = 0; Index < 4; ++Index)
+	{
+		FVector WorldOrigin, WorldDirection;
+		if (!FootprintProjection.DeprojectScreenToWorld(ScreenCorners[Index], WorldOrigin, WorldDirection))
+		{
+			GroundFootprint.bIsValid = false;
+			return;
+		}
+
+		GroundFootprint.Corners[Index] = IntersectGroundPlane(WorldOrigin, WorldDirection);
+	}
+
+	GroundFootprint.bIsValid = true;
+	GroundFootprint.Finalize();
+
+	FootprintViewLocation = ViewInfo.Location;
+	FootprintViewRotation = ViewInfo.Rotation;
+	FootprintFieldOfView = ViewInfo.FOV;
+	FootprintViewportSize = ViewportSize;
+
+	OnGroundFootprintChanged.Broadcast(GroundFootprint);
+}
+
 inline void ATopDownPlayer::DepthOfField()
 {
 	float FocalDistance = SpringArm->TargetArmLength;
@@ -391,35 +1566,40 @@ inline void ATopDownPlayer::DepthOfField()
 
 inline bool ATopDownPlayer::ProjectToGroundPlane(APlayerController* LocalPlayerController, FVector2D& OutScreenPos, FVector& OutIntersection)
 {
-	if (!LocalPlayerController) { UE_LOG(LogTemp, Warning, TEXT("ProjectToGroundPlane PlayerController was not initialized")) return false; }
+	return (this->*InputRoutines.ProjectToGroundPlane)(OutScreenPos, OutIntersection);
+}
 
-	int32 ViewportX, ViewportY;
-	PlayerController->GetViewportSize(ViewportX, ViewportY);
-	FVector2D ViewportSize = FVector2D(ViewportX, ViewportY);
-	FVector2D ViewportCenter = ViewportSize * 0.5f;
-	
-	float MouseX, MouseY;
-	bool bGotMousePos = PlayerController->GetMousePosition(MouseX, MouseY);
-	FVector2D MousePosition = FVector2D(MouseX, MouseY);
+template<typename TInputPolicy>
+bool ATopDownPlayer::GetPointerPositionImpl(FVector2D& OutScreenPos)
+{
+	if (!InputSource) { UE_LOG(LogTemp, Warning, TEXT("GetPointerPosition InputSource was not initialized")) OutScreenPos = FVector2D::ZeroVector; return false; }
 
-	float TouchX, TouchY;
-	bool bGotTouchPos;
-	PlayerController->GetInputTouchState(ETouchIndex::Touch1, TouchX, TouchY, bGotTouchPos);
-	FVector2D TouchPosition = FVector2D(TouchX, TouchY);
+	const FVector2D ViewportCenter = FVector2D(InputSource->GetViewportSize()) * 0.5f;
 
-	OutScreenPos = ViewportCenter;
+	// Only the active device is queried, falls back to the viewport center
+	return TInputPolicy::GetPointerPosition(*this, *InputSource, ViewportCenter, OutScreenPos);
+}
 
-	if (CurrentInputType == EInputType::KeyMouse && bGotMousePos)
-	{
-		OutScreenPos = MousePosition;
-	}
-	else if (CurrentInputType == EInputType::Touch && bGotTouchPos)
-	{
-		OutScreenPos = TouchPosition;
-	}
+template<typename TInputPolicy>
+bool ATopDownPlayer::ProjectToGroundPlaneImpl(FVector2D& OutScreenPos, FVector& OutIntersection)
+{
+	bool bGotPointerPos;
+	return DeprojectPointerImpl<TInputPolicy>(OutScreenPos, OutIntersection, bGotPointerPos) && bGotPointerPos;
+}
+
+template<typename TInputPolicy>
+bool ATopDownPlayer::DeprojectPointerImpl(FVector2D& OutScreenPos, FVector& OutIntersection, bool& bOutGotPointerPos)
+{
+	OutScreenPos = FVector2D::ZeroVector;
+	OutIntersection = FVector::ZeroVector;
+	bOutGotPointerPos = false;
+
+	if (!InputSource) { UE_LOG(LogTemp, Warning, TEXT("ProjectToGroundPlane InputSource was not initialized")) return false; }
+
+	bOutGotPointerPos = GetPointerPositionImpl<TInputPolicy>(OutScreenPos);
 
 	FVector WorldOrigin, WorldDirection;
-	if (!PlayerController->DeprojectScreenPositionToWorld(OutScreenPos.X, OutScreenPos.Y, WorldOrigin, WorldDirection))
+	if (!InputSource->DeprojectScreenToWorld(OutScreenPos, WorldOrigin, WorldDirection))
 	{
 		return false;
 	}
@@ -428,66 +1608,33 @@ inline bool ATopDownPlayer::ProjectToGroundPlane(APlayerController* LocalPlayerC
 	FVector LineEnd = WorldOrigin + (WorldDirection * 1000000.f);
 	FPlane Plane = UKismetMathLibrary::MakePlaneFromPointAndNormal(FVector::ZeroVector, FVector(0.0f, 0.0f, 1.0f));
 	
+	// Rays that never reach the plane are clamped to the end of the ray, like DeprojectScreenToGround
 	float TValue;
-	FVector Intersection;
+	FVector Intersection = FVector(LineEnd.X, LineEnd.Y, 0.0f);
 	UKismetMathLibrary::LinePlaneIntersection(LineStart, LineEnd, Plane, TValue, Intersection);
-	
-	if (CurrentInputType == EInputType::Touch)
-	{
-		OutIntersection = Intersection + FVector(0.0f, 0.0f, -500.f);
-	}
-	else
-	{
-		OutIntersection = Intersection;
-	}
-
-	switch (CurrentInputType)
-	{
-	case EInputType::Unknown:
-
-		return false;
-
-	case EInputType::KeyMouse:
-		
-		return bGotMousePos;
-
-	case EInputType::Gamepad:
 
-		return true;
+	OutIntersection = Intersection + FVector(0.0f, 0.0f, TInputPolicy::GroundOffset);
 
-	case EInputType::Touch:
-
-		return bGotTouchPos;
-
-	default:
-
-		return false;
-	}
+	return true;
 }
 
 inline void ATopDownPlayer::CursorDistFromCenter(APlayerController* LocalPlayerController, FVector2D CursorPos, FVector& Direction, float& Strenght)
 {
-	if (!LocalPlayerController) { UE_LOG(LogTemp, Warning, TEXT("CursorDistFromCenter PlayerController was not initialized")) return; }
+	(this->*InputRoutines.CursorDistFromCenter)(CursorPos, Direction, Strenght);
+}
+
+template<typename TInputPolicy>
+void ATopDownPlayer::CursorDistFromCenterImpl(FVector2D CursorPos, FVector& Direction, float& Strenght)
+{
+	if (!InputSource) { UE_LOG(LogTemp, Warning, TEXT("CursorDistFromCenter InputSource was not initialized")) return; }
 
-	int32 ViewportX, ViewportY;
-	PlayerController->GetViewportSize(ViewportX, ViewportY);
-	FVector2D ViewportCenter = FVector2D(ViewportX, ViewportY) * 0.5f;
+	FVector2D ViewportCenter = FVector2D(InputSource->GetViewportSize()) * 0.5f;
 
 	float AbsCursorPosX, AbsCursorPosY;
 	AbsCursorPosX = UKismetMathLibrary::Abs(CursorPos.X);
 	AbsCursorPosY = UKismetMathLibrary::Abs(CursorPos.Y);
 
-	float EdgeMoveScale = 0.0f;
-	if (CurrentInputType == EInputType::Touch || CurrentInputType == EInputType::Gamepad)
-	{
-		EdgeMoveScale = 2.0f;
-	}
-	else if (CurrentInputType == EInputType::KeyMouse)
-	{
-		EdgeMoveScale = 1.0f;
-	}
-	
-	float ScaledEdgeMoveDistance = EdgeMoveDistance * EdgeMoveScale;
+	float ScaledEdgeMoveDistance = EdgeMoveDistance * TInputPolicy::EdgeMoveScale;
 
 	ViewportCenter.X = ViewportCenter.X - ScaledEdgeMoveDistance;
 	ViewportCenter.Y = ViewportCenter.Y - ScaledEdgeMoveDistance;
@@ -511,16 +1658,14 @@ inline void ATopDownPlayer::CursorDistFromCenter(APlayerController* LocalPlayerC
 inline void ATopDownPlayer::EdgeMove(APlayerController* LocalPlayerController,FVector& Direction, float& Strenght)
 {
 
-	if (!LocalPlayerController) { UE_LOG(LogTemp, Warning, TEXT("EdgeMove PlayerController was not initialized")) return; }
+	if (!InputSource) { UE_LOG(LogTemp, Warning, TEXT("EdgeMove InputSource was not initialized")) return; }
 
 	FVector2D ProjectionScreenPos;
 	FVector ProjectionIntersection;
-	
-	int32 ViewportX, ViewportY;
-	PlayerController->GetViewportSize(ViewportX, ViewportY);
-	FVector2D ViewportCenter = FVector2D(ViewportX, ViewportY) * 0.5f;
 
-	bool bIsProjectionSuccess = ProjectToGroundPlane(LocalPlayerController, ProjectionScreenPos, ProjectionIntersection);
+	ProjectToGroundPlane(LocalPlayerController, ProjectionScreenPos, ProjectionIntersection);
+
+	FVector2D ViewportCenter = FVector2D(InputSource->GetViewportSize()) * 0.5f;
 
 	FVector2D CursorOffsetFromCenter = ProjectionScreenPos - ViewportCenter;
 	CursorDistFromCenter(LocalPlayerController, CursorOffsetFromCenter, Direction, Strenght);
@@ -531,20 +1676,49 @@ inline void ATopDownPlayer::EdgeMove(APlayerController* LocalPlayerController,FV
 
 }
 
+template<typename TInputPolicy>
+void ATopDownPlayer::EdgeMoveImpl(const FVector2D& ScreenPos, FVector& Direction, float& Strenght)
+{
+	FVector2D ViewportCenter = FVector2D(InputSource->GetViewportSize()) * 0.5f;
+
+	FVector2D CursorOffsetFromCenter = ScreenPos - ViewportCenter;
+	CursorDistFromCenterImpl<TInputPolicy>(CursorOffsetFromCenter, Direction, Strenght);
+
+	FTransform ActorTransform = GetActorTransform();
+
+	Direction = UKismetMathLibrary::TransformDirection(ActorTransform, Direction);
+}
+
 inline bool ATopDownPlayer::SingleTouchCheck(APlayerController* LocalPlayerController)
 {
-	double TouchX, TouchY;
-	bool bIsCurrentlyPressed;
-	LocalPlayerController->GetInputTouchState(ETouchIndex::Touch2, TouchX, TouchY, bIsCurrentlyPressed);
+	// A second finger can only be down while touch is the active device
+	if (CurrentInputType != EInputType::Touch || !InputSource) return true;
+
+	FVector2D TouchPosition;
+	return !InputSource->GetTouchState(ETouchIndex::Touch2, TouchPosition);
+}
+
+inline bool ATopDownPlayer::CollisionOverlapCheck() const
+{
+	// Walks the cached overlaps instead of gathering them into a new array on every call
+	for (const FOverlapInfo& Overlap : CollisionSphere->GetOverlapInfos())
+	{
+		if (Overlap.OverlapInfo.GetActor() != nullptr)
+		{
+			return true;
+		}
+	}
+	return false;
+}
 
-	return (!bIsCurrentlyPressed);
+FVector ATopDownPlayer::GetCursorLocation() const
+{
+	return CollisionSphere->GetComponentLocation();
 }
 
-inline bool ATopDownPlayer::CollisionOverlapCheck()
+bool ATopDownPlayer::IsHoveringSelectable() const
 {
-	TArray<AActor*> ActorArray;
-	CollisionSphere->GetOverlappingActors(ActorArray);
-	return ((ActorArray.Num() > 0) && (ActorArray[0] != nullptr));
+	return CollisionOverlapCheck();
 }
 
 void ATopDownPlayer::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
@@ -553,12 +1727,37 @@ void ATopDownPlayer::SetupPlayerInputComponent(UInputComponent* PlayerInputCompo
 
 	if (UEnhancedInputComponent* EnhancedInputComponent = CastChecked<UEnhancedInputComponent>(PlayerInputComponent))
 	{
-		EnhancedInputComponent->BindAction(InputActions->MoveAction, ETriggerEvent::Triggered, this, &ATopDownPlayer::Move);
-		EnhancedInputComponent->BindAction(InputActions->DragMoveAction, ETriggerEvent::Triggered, this, &ATopDownPlayer::DragMove);
-		EnhancedInputComponent->BindAction(InputActions->SpinAction, ETriggerEvent::Triggered, this, &ATopDownPlayer::Spin);
-		EnhancedInputComponent->BindAction(InputActions->ZoomAction, ETriggerEvent::Triggered, this, &ATopDownPlayer::Zoom);
-		EnhancedInputComponent->BindAction(InputActions->SelectAction, ETriggerEvent::Started, this, &ATopDownPlayer::SelectStarted);
-		EnhancedInputComponent->BindAction(InputActions->SelectAction, ETriggerEvent::Canceled, this, &ATopDownPlayer::SelectStopped);
-		EnhancedInputComponent->BindAction(InputActions->SelectAction, ETriggerEvent::Completed, this, &ATopDownPlayer::SelectStopped);
+		// The actions are streamed once a local player possesses the pawn, the input component is usually created before they arrive
+		if (bInputAssetsLoaded)
+		{
+			BindInputActions(EnhancedInputComponent);
+		}
+		else
+		{
+			PendingInputComponent = EnhancedInputComponent;
+		}
+	}
+}
+
+void ATopDownPlayer::BindInputActions(UEnhancedInputComponent* EnhancedInputComponent)
+{
+	const UInputDataSetup* LoadedInputActions = InputActions.Get();
+	if (!LoadedInputActions) { UE_LOG(LogTemp, Warning, TEXT("BindInputActions InputActions was not loaded")) return; }
+
+	EnhancedInputComponent->BindAction(LoadedInputActions->MoveAction.Get(), ETriggerEvent::Triggered, this, &ATopDownPlayer::Move);
+	EnhancedInputComponent->BindAction(LoadedInputActions->DragMoveAction.Get(), ETriggerEvent::Triggered, this, &ATopDownPlayer::DragMove);
+	EnhancedInputComponent->BindAction(LoadedInputActions->SpinAction.Get(), ETriggerEvent::Triggered, this, &ATopDownPlayer::Spin);
+	if (const UInputAction* CursorAction = LoadedInputActions->CursorAction.Get())
+	{
+		EnhancedInputComponent->BindAction(CursorAction, ETriggerEvent::Triggered, this, &ATopDownPlayer::CursorMove);
+		EnhancedInputComponent->BindAction(CursorAction, ETriggerEvent::Completed, this, &ATopDownPlayer::CursorMove);
+	}
+	if (const UInputAction* CommandAction = LoadedInputActions->CommandAction.Get())
+	{
+		EnhancedInputComponent->BindAction(CommandAction, ETriggerEvent::Started, this, &ATopDownPlayer::IssueMoveCommand);
 	}
+	EnhancedInputComponent->BindAction(LoadedInputActions->ZoomAction.Get(), ETriggerEvent::Triggered, this, &ATopDownPlayer::Zoom);
+	EnhancedInputComponent->BindAction(LoadedInputActions->SelectAction.Get(), ETriggerEvent::Started, this, &ATopDownPlayer::SelectStarted);
+	EnhancedInputComponent->BindAction(LoadedInputActions->SelectAction.Get(), ETriggerEvent::Canceled, this, &ATopDownPlayer::SelectStopped);
+	EnhancedInputComponent->BindAction(LoadedInputActions->SelectAction.Get(), ETriggerEvent::Completed, this, &ATopDownPlayer::SelectStopped);
 }
\ No newline at end of file
@@ -0,0 +1,61 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Core/TopDownRelevancyComponent.h"
+#include "Core/TopDownRelevancySubsystem.h"
+#include "Components/SceneComponent.h"
+#include "GameFramework/Actor.h"
+
+UTopDownRelevancyComponent::UTopDownRelevancyComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+
+	bRegistered = false;
+}
+
+void UTopDownRelevancyComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Relevancy is only evaluated by a server for replicated actors
+	AActor* Owner = GetOwner();
+	if (!Owner->GetIsReplicated() || !Owner->HasAuthority() || GetNetMode() == NM_Standalone) return;
+
+	UTopDownRelevancySubsystem* RelevancySubsystem = GetWorld()->GetSubsystem<UTopDownRelevancySubsystem>();
+	if (!RelevancySubsystem) return;
+
+	RelevancySubsystem->RegisterActor(Owner);
+	bRegistered = true;
+
+	if (USceneComponent* OwnerRoot = Owner->GetRootComponent())
+	{
+		TransformUpdatedHandle = OwnerRoot->TransformUpdated.AddUObject(this, &UTopDownRelevancyComponent::OnOwnerTransformUpdated);
+	}
+}
+
+void UTopDownRelevancyComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (bRegistered)
+	{
+		if (USceneComponent* OwnerRoot = GetOwner()->GetRootComponent())
+		{
+			OwnerRoot->TransformUpdated.Remove(TransformUpdatedHandle);
+		}
+
+		if (UTopDownRelevancySubsystem* RelevancySubsystem = GetWorld()->GetSubsystem<UTopDownRelevancySubsystem>())
+		{
+			RelevancySubsystem->UnregisterActor(GetOwner());
+		}
+
+		bRegistered = false;
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UTopDownRelevancyComponent::OnOwnerTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	if (UTopDownRelevancySubsystem* RelevancySubsystem = GetWorld()->GetSubsystem<UTopDownRelevancySubsystem>())
+	{
+		RelevancySubsystem->NotifyActorMoved(GetOwner());
+	}
+}
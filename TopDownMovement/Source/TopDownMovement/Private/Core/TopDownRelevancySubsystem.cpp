@@ -0,0 +1,196 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Core/TopDownRelevancySubsystem.h"
+#include "TopDownMovement.h"
+#include "GameFramework/Actor.h"
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Relevancy Viewer Update"), STAT_TopDownRelevancyViewerUpdate, STATGROUP_TopDownMovement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Relevancy Checks"), STAT_TopDownRelevancyChecks, STATGROUP_TopDownMovement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Relevancy Forced Net Updates"), STAT_TopDownRelevancyForcedNetUpdates, STATGROUP_TopDownMovement);
+
+bool FTopDownCameraInterest::Equals(const FTopDownCameraInterest& Other, float Tolerance) const
+{
+	return FVector2D(BoundsMin).Equals(FVector2D(Other.BoundsMin), Tolerance)
+		&& FVector2D(BoundsMax).Equals(FVector2D(Other.BoundsMax), Tolerance);
+}
+
+UTopDownRelevancySubsystem::UTopDownRelevancySubsystem()
+	: ActorGrid(2000.0f)
+{
+	RelevancyMargin = 2000.0f;
+	MaxInterestExtent = 100000.0f;
+}
+
+void UTopDownRelevancySubsystem::Deinitialize()
+{
+	ActorGrid.Reset();
+	ActorLocations.Reset();
+	Viewers.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UTopDownRelevancySubsystem::IsActorNetRelevantFor(const AActor* Actor, const AActor* RealViewer, const AActor* ViewTarget, bool& bOutHandled)
+{
+	bOutHandled = false;
+	if (!Actor) return false;
+
+	const UWorld* World = Actor->GetWorld();
+	const UTopDownRelevancySubsystem* RelevancySubsystem = World ? World->GetSubsystem<UTopDownRelevancySubsystem>() : nullptr;
+	if (!RelevancySubsystem) return false;
+
+	// Same early outs as AActor::IsNetRelevantFor, owner relevancy is left to the default path
+	if (Actor->bAlwaysRelevant || Actor->IsOwnedBy(ViewTarget) || Actor->IsOwnedBy(RealViewer) || Actor == ViewTarget || ViewTarget == Actor->GetInstigator())
+	{
+		bOutHandled = true;
+		return true;
+	}
+	if (Actor->bNetUseOwnerRelevancy && Actor->GetOwner()) return false;
+
+	// Hidden actors without collision are never relevant, wherever the camera is
+	const USceneComponent* ActorRoot = Actor->GetRootComponent();
+	if (Actor->IsHidden() && (!ActorRoot || !ActorRoot->IsCollisionEnabled()))
+	{
+		bOutHandled = true;
+		return false;
+	}
+
+	return RelevancySubsystem->IsRelevantFor(Actor, RealViewer, bOutHandled);
+}
+
+bool UTopDownRelevancySubsystem::IsRelevantFor(const AActor* Actor, const AActor* RealViewer, bool& bOutHandled) const
+{
+	INC_DWORD_STAT(STAT_TopDownRelevancyChecks);
+
+	const FViewer* Viewer = Viewers.Find(RealViewer);
+	if (!Viewer) return false;
+
+	const FIntPoint* Cell = ActorGrid.FindElementCell(const_cast<AActor*>(Actor));
+	if (!Cell) return false;
+
+	bOutHandled = true;
+	return Viewer->Cells.Contains(*Cell);
+}
+
+void UTopDownRelevancySubsystem::RegisterActor(AActor* Actor)
+{
+	if (!Actor) return;
+
+	const FVector Location = Actor->GetActorLocation();
+	ActorGrid.Add(Actor, Location);
+	ActorLocations.Add(Actor, Location);
+}
+
+void UTopDownRelevancySubsystem::UnregisterActor(AActor* Actor)
+{
+	ActorGrid.Remove(Actor);
+	ActorLocations.Remove(Actor);
+}
+
+void UTopDownRelevancySubsystem::NotifyActorMoved(AActor* Actor)
+{
+	FVector* KnownLocation = ActorLocations.Find(Actor);
+	if (!KnownLocation) return;
+
+	const FVector NewLocation = Actor->GetActorLocation();
+	if (NewLocation.Equals(*KnownLocation)) return;
+
+	*KnownLocation = NewLocation;
+	ActorGrid.Update(Actor, NewLocation);
+}
+
+void UTopDownRelevancySubsystem::SetViewerInterest(const AActor* Viewer, const FTopDownCameraInterest& Interest)
+{
+	SCOPE_CYCLE_COUNTER(STAT_TopDownRelevancyViewerUpdate);
+
+	if (!Viewer) return;
+
+	// Clamp around the focus so an oversized footprint cannot make the whole map relevant
+	const FVector2D Focus(Interest.Focus);
+	const FVector2D HalfExtent(MaxInterestExtent * 0.5f);
+	FBox2D Bounds = Interest.GetBounds();
+	Bounds.Min = FVector2D::Max(Bounds.Min, Focus - HalfExtent);
+	Bounds.Max = FVector2D::Min(Bounds.Max, Focus + HalfExtent);
+	if (Bounds.Min.X > Bounds.Max.X || Bounds.Min.Y > Bounds.Max.Y)
+	{
+		Bounds = FBox2D(Focus, Focus);
+	}
+	Bounds = Bounds.ExpandBy(RelevancyMargin);
+
+	const FIntPoint MinCell = ActorGrid.GetCell(FVector(Bounds.Min, 0.0f));
+	const FIntPoint MaxCell = ActorGrid.GetCell(FVector(Bounds.Max, 0.0f));
+	const FIntRect NewCells(MinCell, MaxCell + FIntPoint(1, 1));
+
+	FViewer* ExistingViewer = Viewers.Find(Viewer);
+	if (!ExistingViewer)
+	{
+		Viewers.Add(Viewer, { Interest, NewCells });
+		ForceNetUpdateEnteredCells(NewCells, nullptr);
+		return;
+	}
+
+	ExistingViewer->Interest = Interest;
+	if (ExistingViewer->Cells == NewCells) return;
+
+	ForceNetUpdateEnteredCells(NewCells, &ExistingViewer->Cells);
+	ExistingViewer->Cells = NewCells;
+}
+
+void UTopDownRelevancySubsystem::ForceNetUpdateEnteredCells(const FIntRect& NewCells, const FIntRect* OldCells) const
+{
+	for (int32 CellY = NewCells.Min.Y; CellY < NewCells.Max.Y; ++CellY)
+	{
+		for (int32 CellX = NewCells.Min.X; CellX < NewCells.Max.X; ++CellX)
+		{
+			const FIntPoint Cell(CellX, CellY);
+			if (OldCells && OldCells->Contains(Cell)) continue;
+
+			const TArray<TTopDownSpatialGrid<TWeakObjectPtr<AActor>>::FEntry>* Entries = ActorGrid.FindCell(Cell);
+			if (!Entries) continue;
+
+			for (const TTopDownSpatialGrid<TWeakObjectPtr<AActor>>::FEntry& Entry : *Entries)
+			{
+				if (AActor* Actor = Entry.Element.Get())
+				{
+					Actor->ForceNetUpdate();
+					INC_DWORD_STAT(STAT_TopDownRelevancyForcedNetUpdates);
+				}
+			}
+		}
+	}
+}
+
+void UTopDownRelevancySubsystem::RemoveViewer(const AActor* Viewer)
+{
+	Viewers.Remove(Viewer);
+}
+
+bool UTopDownRelevancySubsystem::GetViewerInterest(const AActor* Viewer, FTopDownCameraInterest& OutInterest) const
+{
+	const FViewer* KnownViewer = Viewers.Find(Viewer);
+	if (!KnownViewer) return false;
+
+	OutInterest = KnownViewer->Interest;
+	return true;
+}
+
+int32 UTopDownRelevancySubsystem::GetNumRelevantActors(const AActor* Viewer) const
+{
+	const FViewer* KnownViewer = Viewers.Find(Viewer);
+	if (!KnownViewer) return INDEX_NONE;
+
+	int32 NumRelevant = 0;
+	for (int32 CellY = KnownViewer->Cells.Min.Y; CellY < KnownViewer->Cells.Max.Y; ++CellY)
+	{
+		for (int32 CellX = KnownViewer->Cells.Min.X; CellX < KnownViewer->Cells.Max.X; ++CellX)
+		{
+			if (const TArray<TTopDownSpatialGrid<TWeakObjectPtr<AActor>>::FEntry>* Entries = ActorGrid.FindCell(FIntPoint(CellX, CellY)))
+			{
+				NumRelevant += Entries->Num();
+			}
+		}
+	}
+	return NumRelevant;
+}
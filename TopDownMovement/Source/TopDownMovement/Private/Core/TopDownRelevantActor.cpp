@@ -0,0 +1,27 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Core/TopDownRelevantActor.h"
+#include "Core/TopDownRelevancyComponent.h"
+#include "Core/TopDownRelevancySubsystem.h"
+#include "Components/SceneComponent.h"
+
+ATopDownRelevantActor::ATopDownRelevantActor()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	bReplicates = true;
+	SetReplicatingMovement(true);
+
+	Root = CreateDefaultSubobject<USceneComponent>(TEXT("RootComponent"));
+	Root->SetMobility(EComponentMobility::Movable);
+	SetRootComponent(Root);
+
+	RelevancyComponent = CreateDefaultSubobject<UTopDownRelevancyComponent>(TEXT("RelevancyComponent"));
+}
+
+bool ATopDownRelevantActor::IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const
+{
+	bool bHandled;
+	const bool bRelevant = UTopDownRelevancySubsystem::IsActorNetRelevantFor(this, RealViewer, ViewTarget, bHandled);
+	return bHandled ? bRelevant : Super::IsNetRelevantFor(RealViewer, ViewTarget, SrcLocation);
+}
@@ -0,0 +1,49 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Core/TopDownSelectableComponent.h"
+#include "Core/TopDownSelectionSubsystem.h"
+#include "Components/SceneComponent.h"
+#include "GameFramework/Actor.h"
+
+UTopDownSelectableComponent::UTopDownSelectableComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UTopDownSelectableComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (UTopDownSelectionSubsystem* SelectionSubsystem = GetWorld()->GetSubsystem<UTopDownSelectionSubsystem>())
+	{
+		SelectionSubsystem->RegisterSelectable(GetOwner());
+	}
+
+	if (USceneComponent* OwnerRoot = GetOwner()->GetRootComponent())
+	{
+		TransformUpdatedHandle = OwnerRoot->TransformUpdated.AddUObject(this, &UTopDownSelectableComponent::OnOwnerTransformUpdated);
+	}
+}
+
+void UTopDownSelectableComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (USceneComponent* OwnerRoot = GetOwner()->GetRootComponent())
+	{
+		OwnerRoot->TransformUpdated.Remove(TransformUpdatedHandle);
+	}
+
+	if (UTopDownSelectionSubsystem* SelectionSubsystem = GetWorld()->GetSubsystem<UTopDownSelectionSubsystem>())
+	{
+		SelectionSubsystem->UnregisterSelectable(GetOwner());
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UTopDownSelectableComponent::OnOwnerTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	if (UTopDownSelectionSubsystem* SelectionSubsystem = GetWorld()->GetSubsystem<UTopDownSelectionSubsystem>())
+	{
+		SelectionSubsystem->NotifySelectableMoved(GetOwner());
+	}
+}
@@ -0,0 +1,144 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Core/TopDownSelectionSubsystem.h"
+#include "GameFramework/Actor.h"
+
+UTopDownSelectionSubsystem::UTopDownSelectionSubsystem()
+	: SelectableGrid(1000.0f)
+{
+}
+
+void UTopDownSelectionSubsystem::Deinitialize()
+{
+	SelectableGrid.Reset();
+	SelectableLocations.Reset();
+	SelectableMovedListeners.Reset();
+	Selection.Reset();
+
+	Super::Deinitialize();
+}
+
+void UTopDownSelectionSubsystem::RegisterSelectable(AActor* Actor)
+{
+	if (!Actor) return;
+
+	const FVector Location = Actor->GetActorLocation();
+	SelectableGrid.Add(Actor, Location);
+	SelectableLocations.Add(Actor, Location);
+}
+
+void UTopDownSelectionSubsystem::UnregisterSelectable(AActor* Actor)
+{
+	SelectableGrid.Remove(Actor);
+	if (SelectableLocations.Remove(Actor) > 0)
+	{
+		OnSelectableUnregistered.Broadcast(Actor);
+	}
+	SelectableMovedListeners.Remove(Actor);
+	RemoveFromSelection(Actor);
+}
+
+bool UTopDownSelectionSubsystem::GetSelectableLocation(const AActor* Actor, FVector& OutLocation) const
+{
+	const FVector* KnownLocation = SelectableLocations.Find(const_cast<AActor*>(Actor));
+	if (!KnownLocation) return false;
+
+	OutLocation = *KnownLocation;
+	return true;
+}
+
+void UTopDownSelectionSubsystem::NotifySelectableMoved(AActor* Actor)
+{
+	FVector* KnownLocation = SelectableLocations.Find(Actor);
+	if (!KnownLocation) return;
+
+	const FVector NewLocation = Actor->GetActorLocation();
+	if (NewLocation.Equals(*KnownLocation)) return;
+
+	const FVector OldLocation = *KnownLocation;
+	*KnownLocation = NewLocation;
+	SelectableGrid.Update(Actor, NewLocation);
+
+	OnSelectableMoved.Broadcast(Actor, OldLocation, NewLocation);
+
+	if (SelectableMovedListeners.Num() > 0)
+	{
+		if (const FOnSelectableMovedSignature* Listeners = SelectableMovedListeners.Find(Actor))
+		{
+			Listeners->Broadcast(Actor, OldLocation, NewLocation);
+		}
+	}
+}
+
+FDelegateHandle UTopDownSelectionSubsystem::AddSelectableMovedListener(const AActor* Actor, FOnSelectableMovedSignature::FDelegate&& Delegate)
+{
+	if (!Actor) return FDelegateHandle();
+
+	return SelectableMovedListeners.FindOrAdd(Actor).Add(MoveTemp(Delegate));
+}
+
+void UTopDownSelectionSubsystem::RemoveSelectableMovedListener(const AActor* Actor, FDelegateHandle Handle)
+{
+	FOnSelectableMovedSignature* Listeners = SelectableMovedListeners.Find(Actor);
+	if (!Listeners) return;
+
+	Listeners->Remove(Handle);
+	if (!Listeners->IsBound())
+	{
+		SelectableMovedListeners.Remove(Actor);
+	}
+}
+
+void UTopDownSelectionSubsystem::FindSelectablesInRadius(const FVector& Location, float Radius, TArray<AActor*>& OutActors) const
+{
+	OutActors.Reset();
+
+	SelectableGrid.ForEachInRadius(FVector2D(Location), Radius, [&OutActors](const TTopDownSpatialGrid<TWeakObjectPtr<AActor>>::FEntry& Entry)
+	{
+		if (AActor* Actor = Entry.Element.Get())
+		{
+			OutActors.Add(Actor);
+		}
+		return true;
+	});
+}
+
+void UTopDownSelectionSubsystem::SetSelection(const TArray<AActor*>& Actors)
+{
+	Selection.Reset(Actors.Num());
+	for (AActor* Actor : Actors)
+	{
+		if (Actor)
+		{
+			Selection.AddUnique(Actor);
+		}
+	}
+
+	OnSelectionChanged.Broadcast();
+}
+
+void UTopDownSelectionSubsystem::AddToSelection(AActor* Actor)
+{
+	if (Actor && !Selection.Contains(Actor))
+	{
+		Selection.Add(Actor);
+		OnSelectionChanged.Broadcast();
+	}
+}
+
+void UTopDownSelectionSubsystem::RemoveFromSelection(AActor* Actor)
+{
+	if (Selection.Remove(Actor) > 0)
+	{
+		OnSelectionChanged.Broadcast();
+	}
+}
+
+void UTopDownSelectionSubsystem::ClearSelection()
+{
+	if (Selection.Num() > 0)
+	{
+		Selection.Reset();
+		OnSelectionChanged.Broadcast();
+	}
+}
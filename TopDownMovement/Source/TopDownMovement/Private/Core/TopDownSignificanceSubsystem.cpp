@@ -0,0 +1,342 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Core/TopDownSignificanceSubsystem.h"
+#include "TopDownMovement.h"
+#include "GameFramework/Actor.h"
+
+DECLARE_CYCLE_STAT(TEXT("Significance Tick"), STAT_TopDownSignificanceTick, STATGROUP_TopDownMovement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Significance Tier Changes"), STAT_TopDownSignificanceTierChanges, STATGROUP_TopDownMovement);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Significance Actor Evaluations"), STAT_TopDownSignificanceEvaluations, STATGROUP_TopDownMovement);
+
+namespace TopDownSignificance
+{
+	static FTopDownSignificanceTier MakeTier(float FootprintRadiusScale, float TickInterval)
+	{
+		FTopDownSignificanceTier Tier;
+		Tier.FootprintRadiusScale = FootprintRadiusScale;
+		Tier.TickInterval = TickInterval;
+		return Tier;
+	}
+}
+
+UTopDownSignificanceSubsystem::UTopDownSignificanceSubsystem()
+	: ActorGrid(2000.0f)
+{
+	TierHysteresis = 0.1f;
+	bCellsDirty = true;
+
+	Tiers.Add(TopDownSignificance::MakeTier(1.0f, 0.0f));
+	Tiers.Add(TopDownSignificance::MakeTier(2.0f, 0.1f));
+	Tiers.Add(TopDownSignificance::MakeTier(4.0f, 0.5f));
+	Tiers.Add(TopDownSignificance::MakeTier(8.0f, 1.0f));
+	TierPopulation.Init(0, Tiers.Num());
+}
+
+void UTopDownSignificanceSubsystem::Deinitialize()
+{
+	while (RegisteredActors.Num() > 0)
+	{
+		RemoveAtSwap(RegisteredActors.Num() - 1);
+	}
+
+	Super::Deinitialize();
+}
+
+TStatId UTopDownSignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UTopDownSignificanceSubsystem, STATGROUP_Tickables);
+}
+
+void UTopDownSignificanceSubsystem::PublishCameraFocus(const FTopDownCameraFocus& NewCameraFocus)
+{
+	const bool bFootprintChanged = !FMath::IsNearlyEqual(CameraFocus.FootprintRadius, NewCameraFocus.FootprintRadius) || TierDistancesSquared.Num() != Tiers.Num();
+	bCellsDirty |= bFootprintChanged || !CameraFocus.ViewCenter.Equals(NewCameraFocus.ViewCenter);
+
+	CameraFocus = NewCameraFocus;
+
+	if (bFootprintChanged)
+	{
+		TierDistancesSquared.SetNumUninitialized(Tiers.Num());
+		for (int32 TierIndex = 0; TierIndex < Tiers.Num(); ++TierIndex)
+		{
+			TierDistancesSquared[TierIndex] = FMath::Square(Tiers[TierIndex].FootprintRadiusScale * CameraFocus.FootprintRadius);
+		}
+	}
+
+	OnCameraFocusPublished.Broadcast(CameraFocus);
+}
+
+void UTopDownSignificanceSubsystem::SetSignificanceTiers(const TArray<FTopDownSignificanceTier>& NewTiers)
+{
+	if (NewTiers.Num() == 0) { UE_LOG(LogTemp, Warning, TEXT("SetSignificanceTiers requires at least one tier")) return; }
+
+	Tiers = NewTiers;
+	TierDistancesSquared.Reset();
+	TierPopulation.Init(0, Tiers.Num());
+
+	// Force every actor to be re-bucketed against the new tiers
+	for (FRegisteredActor& Entry : RegisteredActors)
+	{
+		Entry.Tier = INDEX_NONE;
+	}
+	CellTiers.Reset();
+	bCellsDirty = true;
+
+	PublishCameraFocus(CameraFocus);
+}
+
+void UTopDownSignificanceSubsystem::RegisterActor(AActor* Actor)
+{
+	if (!Actor || ActorIndices.Contains(TObjectKey<AActor>(Actor))) return;
+
+	FRegisteredActor& Entry = RegisteredActors.AddDefaulted_GetRef();
+	Entry.Actor = Actor;
+	Entry.Key = TObjectKey<AActor>(Actor);
+	Entry.OriginalTickInterval = Actor->GetActorTickInterval();
+
+	// Moves are picked up from the root, actors without one keep the tier of their registration location
+	if (USceneComponent* Root = Actor->GetRootComponent())
+	{
+		Entry.Root = Root;
+		Entry.MovedHandle = Root->TransformUpdated.AddUObject(this, &UTopDownSignificanceSubsystem::OnActorMoved, Entry.Key);
+	}
+	Actor->OnDestroyed.AddUniqueDynamic(this, &UTopDownSignificanceSubsystem::OnActorDestroyed);
+
+	ActorIndices.Add(Entry.Key, RegisteredActors.Num() - 1);
+	ActorGrid.Add(Entry.Key, Actor->GetActorLocation());
+
+	Entry.bMoved = true;
+	MovedActors.Add(Entry.Key);
+}
+
+void UTopDownSignificanceSubsystem::UnregisterActor(AActor* Actor)
+{
+	if (const int32* Index = ActorIndices.Find(TObjectKey<AActor>(Actor)))
+	{
+		RemoveAtSwap(*Index);
+	}
+}
+
+int32 UTopDownSignificanceSubsystem::GetActorTier(const AActor* Actor) const
+{
+	const int32* Index = ActorIndices.Find(TObjectKey<AActor>(Actor));
+	return Index ? RegisteredActors[*Index].Tier : INDEX_NONE;
+}
+
+int32 UTopDownSignificanceSubsystem::GetTierPopulation(int32 Tier) const
+{
+	return TierPopulation.IsValidIndex(Tier) ? TierPopulation[Tier] : 0;
+}
+
+void UTopDownSignificanceSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_TopDownSignificanceTick);
+
+	if (RegisteredActors.Num() == 0 || TierDistancesSquared.Num() != Tiers.Num()) return;
+
+	if (bCellsDirty)
+	{
+		bCellsDirty = false;
+		UpdateCells();
+	}
+
+	UpdateMovedActors();
+}
+
+void UTopDownSignificanceSubsystem::UpdateCells()
+{
+	TArray<int32, TInlineAllocator<16>> StaleIndices;
+
+	ActorGrid.ForEachCell([this, &StaleIndices](const FIntPoint& Cell, const TArray<TTopDownSpatialGrid<TObjectKey<AActor>>::FEntry>& Entries)
+	{
+		if (Entries.Num() == 0) return;
+
+		// A cell that stays within the same ring keeps the tier all its actors already have
+		const int32 CellTier = ComputeCellTier(Cell);
+		int32& SettledTier = CellTiers.FindOrAdd(Cell, INDEX_NONE);
+		if (CellTier != INDEX_NONE && CellTier == SettledTier) return;
+		SettledTier = CellTier;
+
+		for (const TTopDownSpatialGrid<TObjectKey<AActor>>::FEntry& GridEntry : Entries)
+		{
+			const int32 Index = ActorIndices.FindChecked(GridEntry.Element);
+			if (!EvaluateActor(Index, CellTier))
+			{
+				StaleIndices.Add(Index);
+			}
+		}
+	});
+
+	// Removed after the walk, removing changes the grid. Highest index first, so the swaps do not move a pending one
+	StaleIndices.Sort(TGreater<int32>());
+	for (const int32 Index : StaleIndices)
+	{
+		RemoveAtSwap(Index);
+	}
+}
+
+void UTopDownSignificanceSubsystem::UpdateMovedActors()
+{
+	// Evaluating never moves actors, so the list does not grow while it is walked
+	for (int32 MovedIndex = 0; MovedIndex < MovedActors.Num(); ++MovedIndex)
+	{
+		const int32* Index = ActorIndices.Find(MovedActors[MovedIndex]);
+		if (!Index) continue;
+
+		FRegisteredActor& Entry = RegisteredActors[*Index];
+		Entry.bMoved = false;
+
+		const FIntPoint* Cell = ActorGrid.FindElementCell(Entry.Key);
+		if (!EvaluateActor(*Index, Cell ? ComputeCellTier(*Cell) : INDEX_NONE))
+		{
+			RemoveAtSwap(*Index);
+		}
+	}
+	MovedActors.Reset();
+}
+
+bool UTopDownSignificanceSubsystem::EvaluateActor(int32 Index, int32 CellTier)
+{
+	FRegisteredActor& Entry = RegisteredActors[Index];
+
+	const AActor* Actor = Entry.Actor.Get();
+	if (!Actor) return false;
+
+	INC_DWORD_STAT(STAT_TopDownSignificanceEvaluations);
+
+	const int32 NewTier = CellTier != INDEX_NONE ? CellTier : ComputeTier(Actor->GetActorLocation(), Entry.Tier);
+	if (NewTier != Entry.Tier)
+	{
+		ApplyTier(Entry, NewTier);
+	}
+
+	return true;
+}
+
+void UTopDownSignificanceSubsystem::OnActorMoved(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport, TObjectKey<AActor> Key)
+{
+	const int32* Index = ActorIndices.Find(Key);
+	if (!Index) return;
+
+	FRegisteredActor& Entry = RegisteredActors[*Index];
+	ActorGrid.Update(Key, UpdatedComponent->GetComponentLocation());
+
+	if (!Entry.bMoved)
+	{
+		Entry.bMoved = true;
+		MovedActors.Add(Key);
+	}
+}
+
+void UTopDownSignificanceSubsystem::OnActorDestroyed(AActor* DestroyedActor)
+{
+	UnregisterActor(DestroyedActor);
+}
+
+int32 UTopDownSignificanceSubsystem::ComputeCellTier(const FIntPoint& Cell) const
+{
+	const float CellSize = ActorGrid.GetCellSize();
+	const FBox2D CellBox(FVector2D(Cell) * CellSize, FVector2D(Cell.X + 1, Cell.Y + 1) * CellSize);
+	const FVector2D ViewCenter(CameraFocus.ViewCenter);
+
+	const float NearestDistanceSquared = CellBox.ComputeSquaredDistanceToPoint(ViewCenter);
+	const float FurthestDistanceSquared = FVector2D(
+		FMath::Max(FMath::Abs(ViewCenter.X - CellBox.Min.X), FMath::Abs(ViewCenter.X - CellBox.Max.X)),
+		FMath::Max(FMath::Abs(ViewCenter.Y - CellBox.Min.Y), FMath::Abs(ViewCenter.Y - CellBox.Max.Y))).SizeSquared();
+
+	int32 Tier = Tiers.Num() - 1;
+	for (int32 TierIndex = 0; TierIndex < TierDistancesSquared.Num(); ++TierIndex)
+	{
+		if (NearestDistanceSquared <= TierDistancesSquared[TierIndex])
+		{
+			Tier = TierIndex;
+			break;
+		}
+	}
+
+	// The furthest point has to be in the same ring
+	if (TierDistancesSquared.IsValidIndex(Tier) && Tier < Tiers.Num() - 1 && FurthestDistanceSquared > TierDistancesSquared[Tier])
+	{
+		return INDEX_NONE;
+	}
+
+	// And past the hysteresis band of the ring before, where an actor could still be held in that ring
+	if (Tier > 0 && NearestDistanceSquared <= TierDistancesSquared[Tier - 1] * FMath::Square(1.0f + TierHysteresis))
+	{
+		return INDEX_NONE;
+	}
+
+	return Tier;
+}
+
+int32 UTopDownSignificanceSubsystem::ComputeTier(const FVector& Location, int32 CurrentTier) const
+{
+	const float DistanceSquared = FVector::DistSquared2D(Location, CameraFocus.ViewCenter);
+
+	int32 NewTier = Tiers.Num() - 1;
+	for (int32 TierIndex = 0; TierIndex < TierDistancesSquared.Num(); ++TierIndex)
+	{
+		if (DistanceSquared <= TierDistancesSquared[TierIndex])
+		{
+			NewTier = TierIndex;
+			break;
+		}
+	}
+
+	// Only demote once the actor is clearly past the edge of its current tier
+	if (TierDistancesSquared.IsValidIndex(CurrentTier) && NewTier > CurrentTier)
+	{
+		if (DistanceSquared <= TierDistancesSquared[CurrentTier] * FMath::Square(1.0f + TierHysteresis))
+		{
+			return CurrentTier;
+		}
+	}
+
+	return NewTier;
+}
+
+void UTopDownSignificanceSubsystem::ApplyTier(FRegisteredActor& Entry, int32 NewTier)
+{
+	if (TierPopulation.IsValidIndex(Entry.Tier))
+	{
+		--TierPopulation[Entry.Tier];
+	}
+	++TierPopulation[NewTier];
+
+	Entry.Tier = NewTier;
+	INC_DWORD_STAT(STAT_TopDownSignificanceTierChanges);
+
+	AActor* Actor = Entry.Actor.Get();
+	Actor->SetActorTickInterval(FMath::Max(Tiers[NewTier].TickInterval, Entry.OriginalTickInterval));
+
+	OnSignificanceTierChanged.Broadcast(Actor, NewTier);
+}
+
+void UTopDownSignificanceSubsystem::RemoveAtSwap(int32 Index)
+{
+	FRegisteredActor& Entry = RegisteredActors[Index];
+
+	if (TierPopulation.IsValidIndex(Entry.Tier))
+	{
+		--TierPopulation[Entry.Tier];
+	}
+
+	if (AActor* Actor = Entry.Actor.Get())
+	{
+		Actor->SetActorTickInterval(Entry.OriginalTickInterval);
+		Actor->OnDestroyed.RemoveDynamic(this, &UTopDownSignificanceSubsystem::OnActorDestroyed);
+	}
+	if (USceneComponent* Root = Entry.Root.Get())
+	{
+		Root->TransformUpdated.Remove(Entry.MovedHandle);
+	}
+
+	ActorIndices.Remove(Entry.Key);
+	ActorGrid.Remove(Entry.Key);
+
+	RegisteredActors.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	if (RegisteredActors.IsValidIndex(Index))
+	{
+		ActorIndices.Add(RegisteredActors[Index].Key, Index);
+	}
+}
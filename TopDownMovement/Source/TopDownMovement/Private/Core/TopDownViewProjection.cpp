@@ -0,0 +1,206 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Core/TopDownViewProjection.h"
+#include "Camera/CameraTypes.h"
+#include "Kismet/GameplayStatics.h"
+#include "SceneView.h"
+
+void FTopDownWorldPoints::Reset(int32 NewCapacity, const FVector& NewOrigin)
+{
+	X.Reset(NewCapacity);
+	Y.Reset(NewCapacity);
+	Z.Reset(NewCapacity);
+	Origin = NewOrigin;
+}
+
+void FTopDownWorldPoints::Add(const FVector& Location)
+{
+	const FVector Relative = Location - Origin;
+	X.Add(Relative.X);
+	Y.Add(Relative.Y);
+	Z.Add(Relative.Z);
+}
+
+void FTopDownWorldPoints::Set(int32 Index, const FVector& Location)
+{
+	const FVector Relative = Location - Origin;
+	X[Index] = Relative.X;
+	Y[Index] = Relative.Y;
+	Z[Index] = Relative.Z;
+}
+
+FTopDownViewProjection::FTopDownViewProjection()
+{
+	ViewProjectionMatrix = FMatrix::Identity;
+	InvViewProjectionMatrix = FMatrix::Identity;
+	ViewOrigin = FVector::ZeroVector;
+	ViewportSize = FIntPoint::ZeroValue;
+	bIsValid = false;
+}
+
+void FTopDownViewProjection::Capture(const FMinimalViewInfo& ViewInfo, const FIntPoint& InViewportSize)
+{
+	ViewportSize = InViewportSize;
+	ViewOrigin = ViewInfo.Location;
+	bIsValid = ViewportSize.X > 0 && ViewportSize.Y > 0;
+	if (!bIsValid) return;
+
+	// Keep the horizontal FOV like the default local player aspect ratio constraint
+	FMinimalViewInfo ViewportViewInfo = ViewInfo;
+	ViewportViewInfo.AspectRatio = static_cast<float>(ViewportSize.X) / static_cast<float>(ViewportSize.Y);
+
+	FMatrix ViewMatrix, ProjectionMatrix;
+	UGameplayStatics::GetViewProjectionMatrix(ViewportViewInfo, ViewMatrix, ProjectionMatrix, ViewProjectionMatrix);
+	InvViewProjectionMatrix = ViewProjectionMatrix.Inverse();
+}
+
+bool FTopDownViewProjection::ProjectWorldToScreen(const FVector& WorldLocation, FVector2D& OutScreenPosition) const
+{
+	if (!bIsValid) return false;
+
+	const FVector4 Clip = ViewProjectionMatrix.TransformFVector4(FVector4(WorldLocation, 1.0f));
+	if (Clip.W <= 0.0f) return false;
+
+	const double InvW = 1.0 / Clip.W;
+	const double NdcX = Clip.X * InvW;
+	const double NdcY = Clip.Y * InvW;
+
+	OutScreenPosition.X = (NdcX * 0.5 + 0.5) * ViewportSize.X;
+	OutScreenPosition.Y = (0.5 - NdcY * 0.5) * ViewportSize.Y;
+
+	return FMath::Abs(NdcX) <= 1.0 && FMath::Abs(NdcY) <= 1.0;
+}
+
+bool FTopDownViewProjection::DeprojectScreenToWorld(const FVector2D& ScreenPosition, FVector& OutWorldOrigin, FVector& OutWorldDirection) const
+{
+	if (!bIsValid) return false;
+
+	FSceneView::DeprojectScreenToWorld(ScreenPosition, FIntRect(FIntPoint::ZeroValue, ViewportSize), InvViewProjectionMatrix, OutWorldOrigin, OutWorldDirection);
+	return true;
+}
+
+void FTopDownViewProjection::ProjectPoints(const FTopDownWorldPoints& WorldPoints, FTopDownScreenPoints& OutScreenPoints) const
+{
+	const int32 NumPoints = WorldPoints.Num();
+	OutScreenPoints.X.SetNumUninitialized(NumPoints, EAllowShrinking::No);
+	OutScreenPoints.Y.SetNumUninitialized(NumPoints, EAllowShrinking::No);
+	OutScreenPoints.Visible.SetNumUninitialized(NumPoints, EAllowShrinking::No);
+
+	if (!bIsValid)
+	{
+		FMemory::Memzero(OutScreenPoints.Visible.GetData(), NumPoints);
+		return;
+	}
+
+	const float* RESTRICT InX = WorldPoints.X.GetData();
+	const float* RESTRICT InY = WorldPoints.Y.GetData();
+	const float* RESTRICT InZ = WorldPoints.Z.GetData();
+	float* RESTRICT OutX = OutScreenPoints.X.GetData();
+	float* RESTRICT OutY = OutScreenPoints.Y.GetData();
+	uint8* RESTRICT OutVisible = OutScreenPoints.Visible.GetData();
+
+	const float HalfWidth = ViewportSize.X * 0.5f;
+	const float HalfHeight = ViewportSize.Y * 0.5f;
+
+	// The points are relative to the block origin, fold the translation into the matrix while still in double precision.
+	// With the origin near the camera the translation row stays small and survives the conversion to float
+	const FMatrix RelativeMatrix = FTranslationMatrix(WorldPoints.Origin) * ViewProjectionMatrix;
+
+	float Matrix[4][4];
+	for (int32 Row = 0; Row < 4; ++Row)
+	{
+		for (int32 Column = 0; Column < 4; ++Column)
+		{
+			Matrix[Row][Column] = static_cast<float>(RelativeMatrix.M[Row][Column]);
+		}
+	}
+
+	// Row vector convention: Clip = X * M[0] + Y * M[1] + Z * M[2] + M[3]
+	const VectorRegister4Float M00 = VectorSetFloat1(Matrix[0][0]);
+	const VectorRegister4Float M10 = VectorSetFloat1(Matrix[1][0]);
+	const VectorRegister4Float M20 = VectorSetFloat1(Matrix[2][0]);
+	const VectorRegister4Float M30 = VectorSetFloat1(Matrix[3][0]);
+	const VectorRegister4Float M01 = VectorSetFloat1(Matrix[0][1]);
+	const VectorRegister4Float M11 = VectorSetFloat1(Matrix[1][1]);
+	const VectorRegister4Float M21 = VectorSetFloat1(Matrix[2][1]);
+	const VectorRegister4Float M31 = VectorSetFloat1(Matrix[3][1]);
+	const VectorRegister4Float M03 = VectorSetFloat1(Matrix[0][3]);
+	const VectorRegister4Float M13 = VectorSetFloat1(Matrix[1][3]);
+	const VectorRegister4Float M23 = VectorSetFloat1(Matrix[2][3]);
+	const VectorRegister4Float M33 = VectorSetFloat1(Matrix[3][3]);
+
+	const VectorRegister4Float VecHalfWidth = VectorSetFloat1(HalfWidth);
+	const VectorRegister4Float VecHalfHeight = VectorSetFloat1(HalfHeight);
+	const VectorRegister4Float VecNegHalfHeight = VectorSetFloat1(-HalfHeight);
+	const VectorRegister4Float VecZero = VectorZeroFloat();
+	const VectorRegister4Float VecOne = VectorOneFloat();
+
+	int32 Index = 0;
+	for (; Index + 4 <= NumPoints; Index += 4)
+	{
+		const VectorRegister4Float PX = VectorLoad(InX + Index);
+		const VectorRegister4Float PY = VectorLoad(InY + Index);
+		const VectorRegister4Float PZ = VectorLoad(InZ + Index);
+
+		const VectorRegister4Float ClipX = VectorMultiplyAdd(PX, M00, VectorMultiplyAdd(PY, M10, VectorMultiplyAdd(PZ, M20, M30)));
+		const VectorRegister4Float ClipY = VectorMultiplyAdd(PX, M01, VectorMultiplyAdd(PY, M11, VectorMultiplyAdd(PZ, M21, M31)));
+		const VectorRegister4Float ClipW = VectorMultiplyAdd(PX, M03, VectorMultiplyAdd(PY, M13, VectorMultiplyAdd(PZ, M23, M33)));
+
+		const VectorRegister4Float InvW = VectorReciprocalAccurate(ClipW);
+		const VectorRegister4Float NdcX = VectorMultiply(ClipX, InvW);
+		const VectorRegister4Float NdcY = VectorMultiply(ClipY, InvW);
+
+		VectorStore(VectorMultiplyAdd(NdcX, VecHalfWidth, VecHalfWidth), OutX + Index);
+		VectorStore(VectorMultiplyAdd(NdcY, VecNegHalfHeight, VecHalfHeight), OutY + Index);
+
+		const VectorRegister4Float InFront = VectorCompareGT(ClipW, VecZero);
+		const VectorRegister4Float InsideX = VectorCompareLE(VectorAbs(NdcX), VecOne);
+		const VectorRegister4Float InsideY = VectorCompareLE(VectorAbs(NdcY), VecOne);
+		const uint32 VisibleMask = VectorMaskBits(VectorBitwiseAnd(InFront, VectorBitwiseAnd(InsideX, InsideY)));
+
+		OutVisible[Index + 0] = (VisibleMask >> 0) & 1;
+		OutVisible[Index + 1] = (VisibleMask >> 1) & 1;
+		OutVisible[Index + 2] = (VisibleMask >> 2) & 1;
+		OutVisible[Index + 3] = (VisibleMask >> 3) & 1;
+	}
+
+	for (; Index < NumPoints; ++Index)
+	{
+		const float ClipX = InX[Index] * Matrix[0][0] + InY[Index] * Matrix[1][0] + InZ[Index] * Matrix[2][0] + Matrix[3][0];
+		const float ClipY = InX[Index] * Matrix[0][1] + InY[Index] * Matrix[1][1] + InZ[Index] * Matrix[2][1] + Matrix[3][1];
+		const float ClipW = InX[Index] * Matrix[0][3] + InY[Index] * Matrix[1][3] + InZ[Index] * Matrix[2][3] + Matrix[3][3];
+
+		const float InvW = 1.0f / ClipW;
+		const float NdcX = ClipX * InvW;
+		const float NdcY = ClipY * InvW;
+
+		OutX[Index] = NdcX * HalfWidth + HalfWidth;
+		OutY[Index] = HalfHeight - NdcY * HalfHeight;
+		OutVisible[Index] = (ClipW > 0.0f && FMath::Abs(NdcX) <= 1.0f && FMath::Abs(NdcY) <= 1.0f) ? 1 : 0;
+	}
+}
+
+int32 FTopDownViewProjection::FindNearestToScreenPosition(const FTopDownScreenPoints& ScreenPoints, const FVector2D& ScreenPosition, float MaxDistance)
+{
+	const float* RESTRICT PointsX = ScreenPoints.X.GetData();
+	const float* RESTRICT PointsY = ScreenPoints.Y.GetData();
+	const uint8* RESTRICT Visible = ScreenPoints.Visible.GetData();
+
+	const float CursorX = ScreenPosition.X;
+	const float CursorY = ScreenPosition.Y;
+
+	int32 NearestIndex = INDEX_NONE;
+	float NearestDistanceSquared = FMath::Square(MaxDistance);
+
+	for (int32 Index = 0; Index < ScreenPoints.Num(); ++Index)
+	{
+		const float DistanceSquared = FMath::Square(PointsX[Index] - CursorX) + FMath::Square(PointsY[Index] - CursorY);
+		if (Visible[Index] && DistanceSquared <= NearestDistanceSquared)
+		{
+			NearestDistanceSquared = DistanceSquared;
+			NearestIndex = Index;
+		}
+	}
+
+	return NearestIndex;
+}
@@ -0,0 +1,156 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Tests/TopDownTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Core/InputDataSetup.h"
+#include "Core/TopDownPlayer.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "HAL/PlatformMemory.h"
+#include "UObject/UObjectArray.h"
+
+namespace TopDownAssetLoadTest
+{
+	struct FLoadSample
+	{
+		double StartTime = FPlatformTime::Seconds();
+		int64 StartMemory = int64(FPlatformMemory::GetStats().UsedPhysical);
+		int32 StartObjects = GUObjectArray.GetObjectArrayNumMinusAvailable();
+
+		FString Describe(const TCHAR* What) const
+		{
+			return FString::Printf(TEXT("%s: %.2f ms, resident %+.2f MB, %+d objects"), What,
+				(FPlatformTime::Seconds() - StartTime) * 1000.0,
+				(int64(FPlatformMemory::GetStats().UsedPhysical) - StartMemory) / (1024.0 * 1024.0),
+				GUObjectArray.GetObjectArrayNumMinusAvailable() - StartObjects);
+		}
+	};
+}
+
+/**
+ * Measures what loading BP_Player costs before the first frame and what streaming its input assets costs afterwards,
+ * the sum of both being what the class load cost while the input assets were hard references.
+ * Fails when BP_Player still hard references an input asset, either in the asset registry or because the class load made
+ * one resident, and when a pawn without a local player requests them.
+ * The numbers are only cold when the assets are not resident yet, run it in a fresh -nullrhi process for comparable results.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTopDownAssetLoadTest, "TopDownMovement.AssetLoad", TOPDOWN_TEST_FLAGS | EAutomationTestFlags::PerfFilter)
+
+bool FTopDownAssetLoadTest::RunTest(const FString& Parameters)
+{
+	using namespace TopDownAssetLoadTest;
+
+	static const TCHAR* PlayerClassPath = TEXT("/TopDownMovement/BP_Player.BP_Player_C");
+	static const FName PlayerPackageName(TEXT("/TopDownMovement/BP_Player"));
+
+	const bool bClassWasLoaded = FindObject<UClass>(nullptr, PlayerClassPath) != nullptr;
+	if (bClassWasLoaded)
+	{
+		AddWarning(TEXT("BP_Player was already loaded, the class load numbers are warm and the residency check is skipped"));
+	}
+
+	// Packages BP_Player references at all, and which of them were resident before the class load
+	TArray<FName> HardDependencies;
+	TArray<FName> ReferencedPackages;
+	TSet<FName> ResidentBefore;
+	if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+	{
+		AssetRegistry->GetDependencies(PlayerPackageName, HardDependencies, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+		AssetRegistry->GetDependencies(PlayerPackageName, ReferencedPackages, UE::AssetRegistry::EDependencyCategory::Package);
+	}
+	for (const FName& PackageName : ReferencedPackages)
+	{
+		if (FindPackage(nullptr, *PackageName.ToString()))
+		{
+			ResidentBefore.Add(PackageName);
+		}
+	}
+
+	const FLoadSample ClassLoad;
+	const double ClassLoadStartTime = FPlatformTime::Seconds();
+	UClass* PlayerClass = LoadClass<ATopDownPlayer>(nullptr, PlayerClassPath, nullptr, LOAD_NoWarn | LOAD_Quiet);
+	if (!PlayerClass)
+	{
+		AddWarning(TEXT("BP_Player could not be loaded, the plugin content is not mounted"));
+		return true;
+	}
+	const double ClassLoadMs = (FPlatformTime::Seconds() - ClassLoadStartTime) * 1000.0;
+	AddInfo(ClassLoad.Describe(TEXT("BP_Player class load")));
+
+	TArray<FSoftObjectPath> InputAssetPaths;
+	PlayerClass->GetDefaultObject<ATopDownPlayer>()->GetInputAssetPaths(InputAssetPaths);
+
+	// The saved asset must not hard reference any input asset, otherwise the class load still loads them synchronously
+	for (const FSoftObjectPath& Path : InputAssetPaths)
+	{
+		TestFalse(*FString::Printf(TEXT("BP_Player hard references %s, resave it with the soft reference properties"), *Path.ToString()),
+			HardDependencies.Contains(Path.GetLongPackageFName()));
+	}
+
+	// An input asset resident now that was not before can only have been pulled in by the class load
+	if (!bClassWasLoaded)
+	{
+		int32 NumResident = 0;
+		for (const FSoftObjectPath& Path : InputAssetPaths)
+		{
+			NumResident += Path.ResolveObject() && !ResidentBefore.Contains(Path.GetLongPackageFName()) ? 1 : 0;
+		}
+		TestEqual(TEXT("Input assets loaded by the BP_Player class load"), NumResident, 0);
+	}
+
+	{
+		FTopDownTestWorld TestWorld;
+		FRandomStream RandomStream(7);
+
+		ATopDownPlayer* Player = TestWorld.SpawnSyntheticPlayer(FVector::ZeroVector, RandomStream);
+		if (!TestNotNull(TEXT("Synthetic player"), Player)) return false;
+
+		for (int32 Frame = 0; Frame < 10; ++Frame)
+		{
+			TestWorld.Tick(1.0f / 60.0f);
+		}
+
+		TestFalse(TEXT("A pawn without a local player controller does not load the input assets"), Player->AreInputAssetsLoaded());
+	}
+
+	FStreamableManager StreamableManager;
+
+	const FLoadSample InputLoad;
+	const double InputLoadStartTime = FPlatformTime::Seconds();
+	if (TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(InputAssetPaths))
+	{
+		Handle->WaitUntilComplete();
+	}
+
+	// Second step, as in ATopDownPlayer::OnInputDataLoaded
+	TArray<FSoftObjectPath> ActionPaths;
+	for (const FSoftObjectPath& Path : InputAssetPaths)
+	{
+		if (const UInputDataSetup* InputData = Cast<UInputDataSetup>(Path.ResolveObject()))
+		{
+			InputData->GetActionsToLoad(ActionPaths);
+		}
+	}
+	if (TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(ActionPaths))
+	{
+		Handle->WaitUntilComplete();
+	}
+	AddInfo(InputLoad.Describe(*FString::Printf(TEXT("Input assets streamed (%d assets, %d actions)"), InputAssetPaths.Num(), ActionPaths.Num())));
+
+	// With hard references all of it was paid synchronously by the class load, before the first frame
+	const double InputLoadMs = (FPlatformTime::Seconds() - InputLoadStartTime) * 1000.0;
+	AddInfo(FString::Printf(TEXT("Hard reference baseline: class load %.2f ms + input assets %.2f ms = %.2f ms before the first frame, now %.2f ms"),
+		ClassLoadMs, InputLoadMs, ClassLoadMs + InputLoadMs, ClassLoadMs));
+
+	for (const FSoftObjectPath& Path : InputAssetPaths)
+	{
+		TestNotNull(*FString::Printf(TEXT("%s streamed in"), *Path.ToString()), Path.ResolveObject());
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,111 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Tests/TopDownTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Core/TopDownCommandSubsystem.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarTopDownCommandTestMaxMs(
+	TEXT("TopDown.CommandTest.MaxMs"),
+	8.0f,
+	TEXT("Worst move command time in milliseconds above which the TopDownMovement.Command test fails, half of a 60 Hz frame by default."));
+
+/**
+ * Move orders for 2k units scattered over the map, with null entries mixed into the group like a selection holding destroyed units.
+ * Fails when a command takes longer than TopDown.CommandTest.MaxMs, when two units are given the same formation slot,
+ * or when the assignment makes the units travel further than giving the slots out in index order or in formation order.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTopDownCommandTest, "TopDownMovement.Command", TOPDOWN_TEST_FLAGS | EAutomationTestFlags::PerfFilter)
+
+bool FTopDownCommandTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumUnits = 2000;
+	constexpr int32 NumCommands = 20;
+
+	FRandomStream RandomStream(17);
+	FTopDownTestWorld TestWorld;
+
+	UTopDownCommandSubsystem* CommandSubsystem = TestWorld.GetWorld()->GetSubsystem<UTopDownCommandSubsystem>();
+	if (!TestNotNull(TEXT("Command subsystem"), CommandSubsystem)) return false;
+
+	TArray<AActor*> Units;
+	TArray<FVector> UnitLocations;
+	for (int32 Index = 0; Index < NumUnits; ++Index)
+	{
+		const FVector Location(RandomStream.FRandRange(-20000.0f, 20000.0f), RandomStream.FRandRange(-20000.0f, 20000.0f), 0.0f);
+		Units.Add(TestWorld.SpawnUnit(Location));
+		UnitLocations.Add(Location);
+
+		if (Index % 100 == 0)
+		{
+			Units.Add(nullptr);
+		}
+	}
+
+	double TotalSeconds = 0.0;
+	double WorstSeconds = 0.0;
+	for (int32 Command = 0; Command < NumCommands; ++Command)
+	{
+		const FVector Destination(RandomStream.FRandRange(-30000.0f, 30000.0f), RandomStream.FRandRange(-30000.0f, 30000.0f), 0.0f);
+
+		const double StartSeconds = FPlatformTime::Seconds();
+		CommandSubsystem->IssueMoveCommand(Units, Destination);
+		const double ElapsedSeconds = FPlatformTime::Seconds() - StartSeconds;
+
+		TotalSeconds += ElapsedSeconds;
+		WorstSeconds = FMath::Max(WorstSeconds, ElapsedSeconds);
+	}
+
+	// The assignment on its own, to check every unit got a slot of its own
+	TArray<FVector> Slots;
+	TArray<int32> SlotIndices;
+	CommandSubsystem->GenerateFormationSlots(NumUnits, FVector(30000.0f, 0.0f, 0.0f), FVector::ForwardVector, Slots);
+	UTopDownCommandSubsystem::AssignFormationSlots(UnitLocations, Slots, CommandSubsystem->CandidateSlots, SlotIndices);
+
+	TSet<int32> AssignedSlots;
+	double TotalTravel = 0.0;
+	double IdentityTravel = 0.0;
+	for (int32 Index = 0; Index < NumUnits; ++Index)
+	{
+		AssignedSlots.Add(SlotIndices[Index]);
+		TotalTravel += FVector::Dist2D(UnitLocations[Index], Slots[SlotIndices[Index]]);
+		IdentityTravel += FVector::Dist2D(UnitLocations[Index], Slots[Index]);
+	}
+
+	// Slots are laid out front row first, left to right: hand them to the units in the same order
+	const int32 Columns = FMath::CeilToInt32(FMath::Sqrt(static_cast<float>(NumUnits)));
+	TArray<int32> FormationOrder;
+	for (int32 Index = 0; Index < NumUnits; ++Index)
+	{
+		FormationOrder.Add(Index);
+	}
+	FormationOrder.Sort([&UnitLocations](int32 A, int32 B) { return UnitLocations[A].X > UnitLocations[B].X; });
+	for (int32 RowStart = 0; RowStart < NumUnits; RowStart += Columns)
+	{
+		const int32 RowColumns = FMath::Min(Columns, NumUnits - RowStart);
+		TArrayView<int32>(FormationOrder.GetData() + RowStart, RowColumns).Sort([&UnitLocations](int32 A, int32 B) { return UnitLocations[A].Y < UnitLocations[B].Y; });
+	}
+
+	double SortedTravel = 0.0;
+	for (int32 SlotIndex = 0; SlotIndex < NumUnits; ++SlotIndex)
+	{
+		SortedTravel += FVector::Dist2D(UnitLocations[FormationOrder[SlotIndex]], Slots[SlotIndex]);
+	}
+
+	const double WorstMs = WorstSeconds * 1000.0;
+	const float MaxMs = CVarTopDownCommandTestMaxMs.GetValueOnGameThread();
+	AddInfo(FString::Printf(TEXT("Move command for %d units: avg %.3f ms, worst %.3f ms, avg travel %.1f (index order %.1f, formation order %.1f)"),
+		NumUnits, TotalSeconds * 1000.0 / NumCommands, WorstMs, TotalTravel / NumUnits, IdentityTravel / NumUnits, SortedTravel / NumUnits));
+
+	TestEqual(TEXT("Units with a slot of their own"), AssignedSlots.Num(), NumUnits);
+	TestTrue(FString::Printf(TEXT("Travel %.0f is not longer than in index order %.0f"), TotalTravel, IdentityTravel), TotalTravel <= IdentityTravel);
+	TestTrue(FString::Printf(TEXT("Travel %.0f is not longer than in formation order %.0f"), TotalTravel, SortedTravel), TotalTravel <= SortedTravel);
+	TestTrue(FString::Printf(TEXT("Worst command %.3f ms is within %.3f ms"), WorstMs, MaxMs), WorstMs <= MaxMs);
+
+	return true;
+}
+
+#endif
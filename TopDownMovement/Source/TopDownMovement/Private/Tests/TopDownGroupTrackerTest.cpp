@@ -0,0 +1,73 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Tests/TopDownTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Core/TopDownGroupTracker.h"
+
+/**
+ * Random moves of a group spread over the whole map, including members jumping far away and back, checked against the
+ * centroid and the bin bounds recomputed from every member. Long jumps used to make the tracker walk the empty bins between.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTopDownGroupTrackerTest, "TopDownMovement.GroupTracker", TOPDOWN_TEST_FLAGS | EAutomationTestFlags::EngineFilter)
+
+bool FTopDownGroupTrackerTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumMembers = 64;
+	constexpr int32 NumMoves = 20000;
+	constexpr float BinSize = 200.0f;
+	constexpr float Extent = 1.0e6f;
+
+	FRandomStream RandomStream(13);
+	FTopDownTestWorld TestWorld;
+	FTopDownGroupTracker Tracker(BinSize);
+
+	TArray<AActor*> Members;
+	TArray<FVector> Locations;
+	for (int32 Index = 0; Index < NumMembers; ++Index)
+	{
+		const FVector Location(RandomStream.FRandRange(-1000.0f, 1000.0f), RandomStream.FRandRange(-1000.0f, 1000.0f), 0.0f);
+		AActor* Member = TestWorld.SpawnUnit(Location);
+		Tracker.Add(Member, Location);
+		Members.Add(Member);
+		Locations.Add(Location);
+	}
+
+	int32 NumMismatches = 0;
+	for (int32 Move = 0; Move < NumMoves; ++Move)
+	{
+		const int32 Index = RandomStream.RandHelper(NumMembers);
+		const bool bJump = RandomStream.FRand() < 0.05f;
+		Locations[Index] = bJump
+			? FVector(RandomStream.FRandRange(-Extent, Extent), RandomStream.FRandRange(-Extent, Extent), 0.0f)
+			: Locations[Index] + FVector(RandomStream.FRandRange(-300.0f, 300.0f), RandomStream.FRandRange(-300.0f, 300.0f), 0.0f);
+		Tracker.Move(Members[Index], Locations[Index]);
+
+		FVector2D Sum = FVector2D::ZeroVector;
+		FBox2D ExpectedBounds(ForceInit);
+		for (const FVector& Location : Locations)
+		{
+			Sum += FVector2D(Location);
+			// Same bin rounding as the tracker
+			const FVector2D BinMin(FMath::FloorToInt32(Location.X * (1.0f / BinSize)) * BinSize, FMath::FloorToInt32(Location.Y * (1.0f / BinSize)) * BinSize);
+			ExpectedBounds += FBox2D(BinMin, BinMin + FVector2D(BinSize));
+		}
+
+		const bool bCentroidMatches = Tracker.GetCentroid().Equals(Sum / NumMembers, 0.01);
+		const bool bBoundsMatch = Tracker.GetBounds().Min.Equals(ExpectedBounds.Min, 0.01) && Tracker.GetBounds().Max.Equals(ExpectedBounds.Max, 0.01);
+		NumMismatches += bCentroidMatches && bBoundsMatch ? 0 : 1;
+	}
+
+	TestEqual(TEXT("Moves after which the centroid or bounds were wrong"), NumMismatches, 0);
+
+	for (int32 Index = 0; Index < NumMembers; ++Index)
+	{
+		Tracker.Remove(Members[Index]);
+	}
+	TestTrue(TEXT("Group is empty after removing every member"), Tracker.IsEmpty() && !Tracker.GetBounds().bIsValid);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,115 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Tests/TopDownTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Core/TopDownHeatmap.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace TopDownHeatmapTest
+{
+	void RecordRandomSamples(FRandomStream& RandomStream, const FBox2D& Bounds, int32 NumSamples, FTopDownHeatmap& OutHeatmap)
+	{
+		for (int32 Sample = 0; Sample < NumSamples; ++Sample)
+		{
+			// Kept off the max edges, which are outside the last cell
+			const FVector Location(RandomStream.FRandRange(Bounds.Min.X, Bounds.Max.X - 1.0f), RandomStream.FRandRange(Bounds.Min.Y, Bounds.Max.Y - 1.0f), 0.0f);
+
+			OutHeatmap.RecordTargetHandle(Location);
+			if (RandomStream.FRand() < 0.3f)
+			{
+				OutHeatmap.RecordHover(Location);
+			}
+			OutHeatmap.RecordZoom(Location, RandomStream.FRand());
+		}
+	}
+}
+
+/**
+ * Two recorded sessions saved, loaded back and merged, checked cell by cell against the sum of their counters.
+ * A truncated file and a file with another resolution are written next to them and have to be rejected.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTopDownHeatmapTest, "TopDownMovement.Heatmap", TOPDOWN_TEST_FLAGS | EAutomationTestFlags::EngineFilter)
+
+bool FTopDownHeatmapTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumLayers = static_cast<int32>(ETopDownHeatmapLayer::Num);
+	const FBox2D Bounds(FVector2D(-10000.0f, -5000.0f), FVector2D(10000.0f, 5000.0f));
+	const FIntPoint Resolution(64, 32);
+
+	FRandomStream RandomStream(36);
+
+	FTopDownHeatmap SessionA, SessionB, OtherResolution;
+	SessionA.Init(Bounds, Resolution);
+	SessionB.Init(Bounds, Resolution);
+	OtherResolution.Init(Bounds, Resolution / 2);
+
+	TopDownHeatmapTest::RecordRandomSamples(RandomStream, Bounds, 20000, SessionA);
+	TopDownHeatmapTest::RecordRandomSamples(RandomStream, Bounds, 15000, SessionB);
+	TopDownHeatmapTest::RecordRandomSamples(RandomStream, Bounds, 5000, OtherResolution);
+
+	const FString Directory = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("TopDownHeatmap"));
+	const FString FilenameA = FPaths::Combine(Directory, TEXT("SessionA.tdheat"));
+	const FString FilenameB = FPaths::Combine(Directory, TEXT("SessionB.tdheat"));
+	const FString FilenameOther = FPaths::Combine(Directory, TEXT("OtherResolution.tdheat"));
+	const FString FilenameTruncated = FPaths::Combine(Directory, TEXT("Truncated.tdheat"));
+
+	IFileManager::Get().DeleteDirectory(*Directory, false, true);
+
+	if (!TestTrue(TEXT("Session A saved"), SessionA.SaveToFile(FilenameA))) return false;
+	if (!TestTrue(TEXT("Session B saved"), SessionB.SaveToFile(FilenameB))) return false;
+	if (!TestTrue(TEXT("Other resolution saved"), OtherResolution.SaveToFile(FilenameOther))) return false;
+
+	// Saving over an existing session replaces it and leaves no temporary file behind
+	TestTrue(TEXT("Session A saved over itself"), SessionA.SaveToFile(FilenameA));
+	TestFalse(TEXT("Temporary file removed"), IFileManager::Get().FileExists(*(FilenameA + TEXT(".tmp"))));
+
+	// A session cut off in the middle of its counters
+	TArray<uint8> Bytes;
+	if (!TestTrue(TEXT("Session A read back"), FFileHelper::LoadFileToArray(Bytes, *FilenameA))) return false;
+	Bytes.SetNum(Bytes.Num() - 7);
+	FFileHelper::SaveArrayToFile(Bytes, *FilenameTruncated);
+
+	FTopDownHeatmap Loaded;
+	TestFalse(TEXT("Truncated file rejected"), Loaded.LoadFromFile(FilenameTruncated));
+	if (TestTrue(TEXT("Session A loaded"), Loaded.LoadFromFile(FilenameA)))
+	{
+		TestTrue(TEXT("Loaded resolution"), Loaded.GetResolution() == Resolution);
+		TestTrue(TEXT("Loaded bounds"), Loaded.GetBounds().Min.Equals(Bounds.Min) && Loaded.GetBounds().Max.Equals(Bounds.Max));
+	}
+
+	FTopDownHeatmap Merged;
+	const int32 NumMerged = FTopDownHeatmap::LoadAndMerge({ FilenameA, FilenameTruncated, FilenameOther, FilenameB }, Merged);
+	TestEqual(TEXT("Merged files, the truncated one and the other resolution skipped"), NumMerged, 2);
+	TestTrue(TEXT("Merged resolution"), Merged.GetResolution() == Resolution);
+
+	int32 NumMismatches = 0;
+	uint64 TotalTargetHandle = 0;
+	for (int32 Layer = 0; Layer < NumLayers; ++Layer)
+	{
+		for (int32 Y = 0; Y < Resolution.Y; ++Y)
+		{
+			for (int32 X = 0; X < Resolution.X; ++X)
+			{
+				const ETopDownHeatmapLayer HeatmapLayer = static_cast<ETopDownHeatmapLayer>(Layer);
+				const FIntPoint Cell(X, Y);
+				const uint32 Expected = SessionA.GetCounter(HeatmapLayer, Cell) + SessionB.GetCounter(HeatmapLayer, Cell);
+
+				NumMismatches += Merged.GetCounter(HeatmapLayer, Cell) == Expected ? 0 : 1;
+				TotalTargetHandle += HeatmapLayer == ETopDownHeatmapLayer::TargetHandle ? Merged.GetCounter(HeatmapLayer, Cell) : 0;
+			}
+		}
+	}
+
+	TestEqual(TEXT("Merged counters that differ from the sum of both sessions"), NumMismatches, 0);
+	TestEqual(TEXT("Merged target handle samples"), TotalTargetHandle, uint64(20000 + 15000));
+
+	IFileManager::Get().DeleteDirectory(*Directory, false, true);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,123 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Tests/TopDownTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Core/TopDownOcclusionComponent.h"
+#include "Camera/CameraComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+
+/**
+ * A grid of box buildings and a focus walking the streets between them, the camera looking down at it from behind.
+ * Reports the time of the sweep batches (STAT_TopDownOcclusionBatch) and of the fade ticks (STAT_TopDownOcclusionFade),
+ * and fails when nothing ever gets faded.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTopDownOcclusionTest, "TopDownMovement.Occlusion", TOPDOWN_TEST_FLAGS | EAutomationTestFlags::PerfFilter)
+
+bool FTopDownOcclusionTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 GridSize = 24;
+	constexpr float BuildingSpacing = 600.0f;
+	constexpr int32 NumBatches = 200;
+	constexpr int32 FadeFramesPerBatch = 4;
+	constexpr float DeltaSeconds = 1.0f / 60.0f;
+
+	UStaticMesh* CubeMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	if (!TestNotNull(TEXT("Engine cube mesh"), CubeMesh)) return false;
+
+	FTopDownTestWorld TestWorld;
+
+	// Buildings of 300 x 300 and 600 to 1200 high, the basic cube is 100 units wide
+	FRandomStream RandomStream(34);
+	for (int32 X = 0; X < GridSize; ++X)
+	{
+		for (int32 Y = 0; Y < GridSize; ++Y)
+		{
+			const float Height = RandomStream.FRandRange(600.0f, 1200.0f);
+			AActor* Building = TestWorld.SpawnUnit(FVector(X * BuildingSpacing, Y * BuildingSpacing, Height * 0.5f));
+			if (!Building) continue;
+
+			UStaticMeshComponent* Mesh = NewObject<UStaticMeshComponent>(Building, TEXT("Mesh"));
+			Mesh->SetStaticMesh(CubeMesh);
+			Mesh->SetMobility(EComponentMobility::Movable);
+			Mesh->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+			Mesh->SetupAttachment(Building->GetRootComponent());
+			Mesh->SetRelativeScale3D(FVector(3.0f, 3.0f, Height / 100.0f));
+			Building->AddInstanceComponent(Mesh);
+			Mesh->RegisterComponent();
+		}
+	}
+
+	// The owner is not a pawn, so the component sweeps like it does for a local player
+	AActor* Focus = TestWorld.SpawnUnit(FVector::ZeroVector);
+	if (!TestNotNull(TEXT("Focus"), Focus)) return false;
+
+	UCameraComponent* Camera = NewObject<UCameraComponent>(Focus, TEXT("Camera"));
+	Camera->SetupAttachment(Focus->GetRootComponent());
+	Camera->SetRelativeLocation(FVector(-1200.0f, 0.0f, 1600.0f));
+	Camera->SetRelativeRotation(FVector(1200.0f, 0.0f, -1600.0f).Rotation());
+	Focus->AddInstanceComponent(Camera);
+	Camera->RegisterComponent();
+
+	// Registered after the camera, so it finds it in BeginPlay
+	UTopDownOcclusionComponent* Occlusion = NewObject<UTopDownOcclusionComponent>(Focus, TEXT("Occlusion"));
+	Focus->AddInstanceComponent(Occlusion);
+	Occlusion->RegisterComponent();
+
+	// The test issues the batches itself, keep the timer out of the way
+	Occlusion->SetOcclusionCheckInterval(3600.0f);
+	TestEqual(TEXT("Occlusion check interval"), Occlusion->OcclusionCheckInterval, 3600.0f);
+
+	double TotalBatchMs = 0.0;
+	double WorstBatchMs = 0.0;
+	double TotalFadeMs = 0.0;
+	double WorstFadeMs = 0.0;
+	int32 NumFadeTicks = 0;
+	int32 MaxFaded = 0;
+
+	for (int32 Batch = 0; Batch < NumBatches; ++Batch)
+	{
+		// Walk the streets along a row of buildings, the camera looks over the building behind the focus
+		const float X = (RandomStream.RandRange(1, GridSize - 2) + 0.5f) * BuildingSpacing;
+		const float Y = RandomStream.RandRange(0, GridSize - 1) * BuildingSpacing;
+		Focus->SetActorLocation(FVector(X, Y, 0.0f));
+
+		const double BatchStart = FPlatformTime::Seconds();
+		Occlusion->CheckOcclusionNow();
+		const double BatchMs = (FPlatformTime::Seconds() - BatchStart) * 1000.0;
+
+		TotalBatchMs += BatchMs;
+		WorstBatchMs = FMath::Max(WorstBatchMs, BatchMs);
+
+		// Async sweeps are run at the end of one world tick and answered at the start of the next
+		TestWorld.Tick(DeltaSeconds);
+		TestWorld.Tick(DeltaSeconds);
+
+		MaxFaded = FMath::Max(MaxFaded, Occlusion->GetNumFadedComponents());
+
+		for (int32 Frame = 0; Frame < FadeFramesPerBatch && Occlusion->IsComponentTickEnabled(); ++Frame)
+		{
+			const double FadeStart = FPlatformTime::Seconds();
+			Occlusion->TickComponent(DeltaSeconds, LEVELTICK_All, &Occlusion->PrimaryComponentTick);
+			const double FadeMs = (FPlatformTime::Seconds() - FadeStart) * 1000.0;
+
+			TotalFadeMs += FadeMs;
+			WorstFadeMs = FMath::Max(WorstFadeMs, FadeMs);
+			++NumFadeTicks;
+		}
+	}
+
+	AddInfo(FString::Printf(TEXT("%d buildings: Occlusion Batch avg %.4f ms, worst %.4f ms over %d batches; Occlusion Fade avg %.4f ms, worst %.4f ms over %d ticks; up to %d faded components"),
+		GridSize * GridSize, TotalBatchMs / NumBatches, WorstBatchMs, NumBatches,
+		NumFadeTicks > 0 ? TotalFadeMs / NumFadeTicks : 0.0, WorstFadeMs, NumFadeTicks, MaxFaded));
+
+	TestTrue(TEXT("Buildings between the camera and the focus were faded"), MaxFaded > 0);
+
+	return true;
+}
+
+#endif
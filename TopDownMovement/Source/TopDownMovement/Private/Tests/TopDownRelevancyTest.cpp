@@ -0,0 +1,175 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Tests/TopDownTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Core/TopDownPlayer.h"
+#include "Core/TopDownRelevancySubsystem.h"
+#include "GameFramework/Controller.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarTopDownRelevancyTestMaxMs(
+	TEXT("TopDown.RelevancyTest.MaxMs"),
+	5.0f,
+	TEXT("Average time in milliseconds of one frame's relevancy checks, every actor for every viewer, above which the TopDownMovement.Relevancy test fails."));
+
+/**
+ * 5k replicated units and 8 synthetic players publishing their camera interest. The test world is standalone, where
+ * UTopDownRelevancyComponent does not register, so the units are registered with the subsystem directly.
+ * Every frame checks every unit for every viewer through IsActorNetRelevantFor, like a server with 8 connections would.
+ * Fails when a unit inside a footprint is not relevant, a unit past the margin is, a hidden unit is, when the checks
+ * exceed TopDown.RelevancyTest.MaxMs, or when an unpossessed player's viewer is kept.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTopDownRelevancyTest, "TopDownMovement.Relevancy", TOPDOWN_TEST_FLAGS | EAutomationTestFlags::PerfFilter)
+
+bool FTopDownRelevancyTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumUnits = 5000;
+	constexpr int32 NumPlayers = 8;
+	constexpr int32 NumFrames = 300;
+	constexpr float DeltaSeconds = 1.0f / 60.0f;
+	constexpr float SpreadRadius = 60000.0f;
+
+	FRandomStream RandomStream(19);
+	FTopDownTestWorld TestWorld;
+
+	UTopDownRelevancySubsystem* Relevancy = TestWorld.GetWorld()->GetSubsystem<UTopDownRelevancySubsystem>();
+	if (!TestNotNull(TEXT("Relevancy subsystem"), Relevancy)) return false;
+
+	auto RandomLocation = [&RandomStream]()
+	{
+		return FVector(FVector2D(RandomStream.VRand()).GetSafeNormal() * SpreadRadius * FMath::Sqrt(RandomStream.FRand()), 0.0f);
+	};
+
+	TArray<AActor*> Units;
+	Units.Reserve(NumUnits);
+	for (int32 Index = 0; Index < NumUnits; ++Index)
+	{
+		AActor* Unit = TestWorld.SpawnUnit(RandomLocation());
+		Relevancy->RegisterActor(Unit);
+		Units.Add(Unit);
+	}
+
+	// Hidden and without collision, never relevant wherever it is
+	Units[0]->SetActorHiddenInGame(true);
+
+	TArray<ATopDownPlayer*> Players;
+	for (int32 Index = 0; Index < NumPlayers; ++Index)
+	{
+		if (ATopDownPlayer* Player = TestWorld.SpawnSyntheticPlayer(RandomLocation(), RandomStream))
+		{
+			Players.Add(Player);
+		}
+	}
+	if (!TestEqual(TEXT("Synthetic players"), Players.Num(), NumPlayers)) return false;
+
+	const float NotRelevantDistance = Relevancy->RelevancyMargin + Relevancy->GetCellSize();
+
+	double CheckSeconds = 0.0;
+	int64 NumChecks = 0;
+	int64 NumRelevant = 0;
+	int32 NumMissing = 0;
+	int32 NumTooFar = 0;
+	int32 NumHiddenRelevant = 0;
+	int32 NumMeasuredFrames = 0;
+
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		TestWorld.Tick(DeltaSeconds);
+
+		// Units wander, their moves are reported like UTopDownRelevancyComponent does
+		for (int32 Moved = 0; Moved < NumUnits / 50; ++Moved)
+		{
+			AActor* Unit = Units[RandomStream.RandHelper(NumUnits)];
+			Unit->AddActorWorldOffset(FVector(RandomStream.FRandRange(-300.0f, 300.0f), RandomStream.FRandRange(-300.0f, 300.0f), 0.0f));
+			Relevancy->NotifyActorMoved(Unit);
+		}
+
+		bool bAllViewersKnown = true;
+		for (const ATopDownPlayer* Player : Players)
+		{
+			FTopDownCameraInterest Interest;
+			bAllViewersKnown &= Relevancy->GetViewerInterest(Player->GetController(), Interest);
+		}
+		if (!bAllViewersKnown) continue;
+
+		++NumMeasuredFrames;
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (const ATopDownPlayer* Player : Players)
+		{
+			const AController* Viewer = Player->GetController();
+			for (const AActor* Unit : Units)
+			{
+				bool bHandled;
+				NumRelevant += UTopDownRelevancySubsystem::IsActorNetRelevantFor(Unit, Viewer, Player, bHandled) && bHandled ? 1 : 0;
+			}
+		}
+		CheckSeconds += FPlatformTime::Seconds() - StartTime;
+		NumChecks += int64(Players.Num()) * Units.Num();
+
+		// Correctness on a few frames only, the reference is far slower than the checks
+		if (Frame % 30 != 0) continue;
+
+		for (const ATopDownPlayer* Player : Players)
+		{
+			const AController* Viewer = Player->GetController();
+
+			FTopDownCameraInterest Interest;
+			Relevancy->GetViewerInterest(Viewer, Interest);
+
+			const FVector2D Focus(Interest.Focus);
+			const FVector2D HalfExtent(Relevancy->MaxInterestExtent * 0.5f);
+			FBox2D Bounds = Interest.GetBounds();
+			Bounds.Min = FVector2D::Max(Bounds.Min, Focus - HalfExtent);
+			Bounds.Max = FVector2D::Min(Bounds.Max, Focus + HalfExtent);
+			const FBox2D FarBounds = Bounds.ExpandBy(NotRelevantDistance);
+
+			for (const AActor* Unit : Units)
+			{
+				bool bHandled;
+				const bool bRelevant = UTopDownRelevancySubsystem::IsActorNetRelevantFor(Unit, Viewer, Player, bHandled) && bHandled;
+				const FVector2D Location(Unit->GetActorLocation());
+
+				if (Unit == Units[0])
+				{
+					NumHiddenRelevant += bRelevant ? 1 : 0;
+					continue;
+				}
+
+				NumMissing += Bounds.IsInside(Location) && !bRelevant ? 1 : 0;
+				NumTooFar += !FarBounds.IsInside(Location) && bRelevant ? 1 : 0;
+			}
+		}
+	}
+
+	if (!TestTrue(TEXT("Every synthetic player published its camera interest"), NumMeasuredFrames > 0)) return false;
+
+	const double AverageMs = CheckSeconds * 1000.0 / NumMeasuredFrames;
+	const float MaxMs = CVarTopDownRelevancyTestMaxMs.GetValueOnGameThread();
+	AddInfo(FString::Printf(TEXT("%d units, %d viewers: %.3f ms per frame for all checks (%.1f ns per check), %.1f%% of the units relevant per viewer"),
+		NumUnits, Players.Num(), AverageMs, CheckSeconds * 1.0e9 / FMath::Max<int64>(NumChecks, 1), 100.0 * NumRelevant / FMath::Max<int64>(NumChecks, 1)));
+
+	TestEqual(TEXT("Units inside a footprint that were not relevant"), NumMissing, 0);
+	TestEqual(TEXT("Units past the relevancy margin that were relevant"), NumTooFar, 0);
+	TestEqual(TEXT("Times the hidden unit was relevant"), NumHiddenRelevant, 0);
+	TestTrue(FString::Printf(TEXT("Average checks %.3f ms are within %.3f ms"), AverageMs, MaxMs), AverageMs <= MaxMs);
+
+	// Unpossessing removes the viewer, the controller's connection no longer sees through that camera
+	AController* Controller = Players[0]->GetController();
+	Controller->UnPossess();
+
+	FTopDownCameraInterest Interest;
+	TestFalse(TEXT("The unpossessed player's viewer is removed"), Relevancy->GetViewerInterest(Controller, Interest));
+
+	for (AActor* Unit : Units)
+	{
+		Relevancy->UnregisterActor(Unit);
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,246 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Tests/TopDownTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Core/TopDownSignificanceSubsystem.h"
+#include "Tests/TopDownTestUnit.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarTopDownSignificanceTestMaxMs(
+	TEXT("TopDown.SignificanceTest.MaxMs"),
+	1.0f,
+	TEXT("Average significance update time in milliseconds above which the TopDownMovement.Significance test fails."));
+
+/**
+ * 10k registered actors, 1% of them moving every frame, while the focus pans and zooms across them.
+ * Times the subsystem update against a brute force distance pass over every actor, and checks every actor's tier
+ * against its distance (allowing the hysteresis band) after each frame.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTopDownSignificanceTest, "TopDownMovement.Significance", TOPDOWN_TEST_FLAGS | EAutomationTestFlags::PerfFilter)
+
+bool FTopDownSignificanceTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumActors = 10000;
+	constexpr int32 NumFrames = 600;
+	constexpr float DeltaSeconds = 1.0f / 60.0f;
+	constexpr float SpreadRadius = 80000.0f;
+	constexpr float PanSpeed = 6000.0f;
+
+	FRandomStream RandomStream(5);
+	FTopDownTestWorld TestWorld;
+
+	UTopDownSignificanceSubsystem* Significance = TestWorld.GetWorld()->GetSubsystem<UTopDownSignificanceSubsystem>();
+	if (!TestNotNull(TEXT("Significance subsystem"), Significance)) return false;
+
+	TArray<AActor*> Actors;
+	Actors.Reserve(NumActors);
+	for (int32 Index = 0; Index < NumActors; ++Index)
+	{
+		const FVector2D Offset = FVector2D(RandomStream.VRand()).GetSafeNormal() * SpreadRadius * FMath::Sqrt(RandomStream.FRand());
+		AActor* Actor = TestWorld.SpawnUnit(FVector(Offset, 0.0f));
+		Significance->RegisterActor(Actor);
+		Actors.Add(Actor);
+	}
+
+	// Same tiers as the subsystem defaults, set explicitly so the reference check does not depend on them
+	TArray<FTopDownSignificanceTier> Tiers;
+	const float TierScales[] = { 1.0f, 2.0f, 4.0f, 8.0f };
+	const float TierIntervals[] = { 0.0f, 0.1f, 0.5f, 1.0f };
+	for (int32 TierIndex = 0; TierIndex < UE_ARRAY_COUNT(TierScales); ++TierIndex)
+	{
+		FTopDownSignificanceTier& Tier = Tiers.AddDefaulted_GetRef();
+		Tier.FootprintRadiusScale = TierScales[TierIndex];
+		Tier.TickInterval = TierIntervals[TierIndex];
+	}
+	Significance->SetSignificanceTiers(Tiers);
+
+	double UpdateSeconds = 0.0;
+	double BruteForceSeconds = 0.0;
+	int32 NumWrongTiers = 0;
+	volatile int32 BruteForceSink = 0;
+
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		const float Time = Frame * DeltaSeconds;
+
+		FTopDownCameraFocus Focus;
+		Focus.ViewCenter = FVector(FMath::Sin(Time * 0.2f) * PanSpeed * 5.0f, Time * PanSpeed * 0.5f - SpreadRadius * 0.5f, 0.0f);
+		Focus.FootprintRadius = 4000.0f + 3000.0f * FMath::Sin(Time * 0.5f);
+		Significance->PublishCameraFocus(Focus);
+
+		for (int32 Moved = 0; Moved < NumActors / 100; ++Moved)
+		{
+			AActor* Actor = Actors[RandomStream.RandHelper(NumActors)];
+			Actor->AddActorWorldOffset(FVector(RandomStream.FRandRange(-200.0f, 200.0f), RandomStream.FRandRange(-200.0f, 200.0f), 0.0f));
+		}
+
+		double StartTime = FPlatformTime::Seconds();
+		Significance->Tick(DeltaSeconds);
+		UpdateSeconds += FPlatformTime::Seconds() - StartTime;
+
+		// What a per actor pass costs, without even applying the tiers
+		StartTime = FPlatformTime::Seconds();
+		int32 NumInFirstTier = 0;
+		for (const AActor* Actor : Actors)
+		{
+			NumInFirstTier += FVector::DistSquared2D(Actor->GetActorLocation(), Focus.ViewCenter) <= FMath::Square(Focus.FootprintRadius) ? 1 : 0;
+		}
+		BruteForceSink = NumInFirstTier;
+		BruteForceSeconds += FPlatformTime::Seconds() - StartTime;
+
+		for (const AActor* Actor : Actors)
+		{
+			const float Distance = FVector::Dist2D(Actor->GetActorLocation(), Focus.ViewCenter);
+			int32 ExpectedTier = Tiers.Num() - 1;
+			for (int32 TierIndex = 0; TierIndex < Tiers.Num(); ++TierIndex)
+			{
+				if (Distance <= Tiers[TierIndex].FootprintRadiusScale * Focus.FootprintRadius)
+				{
+					ExpectedTier = TierIndex;
+					break;
+				}
+			}
+
+			// Demotion is held back while the actor is within the hysteresis band of its tier
+			const int32 Tier = Significance->GetActorTier(Actor);
+			const bool bHeld = Tier >= 0 && Tier < ExpectedTier && Distance <= Tiers[Tier].FootprintRadiusScale * Focus.FootprintRadius * (1.0f + Significance->TierHysteresis) * 1.001f;
+			NumWrongTiers += Tier == ExpectedTier || bHeld ? 0 : 1;
+		}
+	}
+
+	const double AverageUpdateMs = UpdateSeconds * 1000.0 / NumFrames;
+	AddInfo(FString::Printf(TEXT("%d actors: significance update %.3f ms per frame, brute force distance pass %.3f ms per frame"),
+		NumActors, AverageUpdateMs, BruteForceSeconds * 1000.0 / NumFrames));
+
+	int32 NumTiered = 0;
+	for (int32 TierIndex = 0; TierIndex < Tiers.Num(); ++TierIndex)
+	{
+		NumTiered += Significance->GetTierPopulation(TierIndex);
+	}
+
+	TestEqual(TEXT("Every actor is in a tier"), NumTiered, NumActors);
+	TestEqual(TEXT("Actors in a tier their distance does not allow"), NumWrongTiers, 0);
+	TestTrue(FString::Printf(TEXT("Average update %.3f ms is within %.3f ms"), AverageUpdateMs, CVarTopDownSignificanceTestMaxMs.GetValueOnGameThread()),
+		AverageUpdateMs <= CVarTopDownSignificanceTestMaxMs.GetValueOnGameThread());
+
+	for (AActor* Actor : Actors)
+	{
+		Significance->UnregisterActor(Actor);
+	}
+
+	return true;
+}
+
+namespace TopDownSignificanceTest
+{
+	struct FTickResult
+	{
+		double AverageTickMs = 0.0;
+		double AverageUnitTicks = 0.0;
+	};
+
+	/**
+	 * Ticks a world of NumUnits ticking units under a fixed camera focus and times the whole world tick,
+	 * significance update included. With bRegister the units are registered with the significance subsystem.
+	 */
+	FTickResult TickUnits(bool bRegister, int32 NumUnits, int32 NumFrames)
+	{
+		constexpr float DeltaSeconds = 1.0f / 60.0f;
+		constexpr int32 WarmUpFrames = 120;
+		constexpr float SpreadRadius = 80000.0f;
+
+		FTickResult Result;
+
+		FRandomStream RandomStream(29);
+		FTopDownTestWorld TestWorld;
+
+		UTopDownSignificanceSubsystem* Significance = TestWorld.GetWorld()->GetSubsystem<UTopDownSignificanceSubsystem>();
+		if (!Significance) return Result;
+
+		TArray<ATopDownTestUnit*> Units;
+		Units.Reserve(NumUnits);
+		for (int32 Index = 0; Index < NumUnits; ++Index)
+		{
+			const FVector2D Offset = FVector2D(RandomStream.VRand()).GetSafeNormal() * SpreadRadius * FMath::Sqrt(RandomStream.FRand());
+			ATopDownTestUnit* Unit = TestWorld.SpawnTickingUnit(FVector(Offset, 0.0f));
+			if (!Unit) continue;
+
+			if (bRegister)
+			{
+				Significance->RegisterActor(Unit);
+			}
+			Units.Add(Unit);
+		}
+
+		FTopDownCameraFocus Focus;
+		Focus.ViewCenter = FVector::ZeroVector;
+		Focus.FootprintRadius = 4000.0f;
+
+		// Tiers with intervals settle their tick phases during the warm up
+		for (int32 Frame = 0; Frame < WarmUpFrames; ++Frame)
+		{
+			Significance->PublishCameraFocus(Focus);
+			TestWorld.Tick(DeltaSeconds);
+		}
+
+		int64 StartTicks = 0;
+		for (const ATopDownTestUnit* Unit : Units)
+		{
+			StartTicks += Unit->NumTicks;
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			Significance->PublishCameraFocus(Focus);
+			TestWorld.Tick(DeltaSeconds);
+		}
+		Result.AverageTickMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 / NumFrames;
+
+		int64 EndTicks = 0;
+		for (ATopDownTestUnit* Unit : Units)
+		{
+			EndTicks += Unit->NumTicks;
+			if (bRegister)
+			{
+				Significance->UnregisterActor(Unit);
+			}
+		}
+		Result.AverageUnitTicks = double(EndTicks - StartTicks) / NumFrames;
+
+		return Result;
+	}
+}
+
+/**
+ * Game thread savings of the significance tiers: 10k units with a real tick cost, the world tick timed once with the units
+ * ticking every frame and once with them registered with the significance subsystem, whose own update is part of the second run.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTopDownSignificanceSavingsTest, "TopDownMovement.SignificanceSavings", TOPDOWN_TEST_FLAGS | EAutomationTestFlags::PerfFilter)
+
+bool FTopDownSignificanceSavingsTest::RunTest(const FString& Parameters)
+{
+	using namespace TopDownSignificanceTest;
+
+	constexpr int32 NumUnits = 10000;
+	constexpr int32 NumFrames = 300;
+
+	const FTickResult Unregistered = TickUnits(false, NumUnits, NumFrames);
+	const FTickResult Registered = TickUnits(true, NumUnits, NumFrames);
+
+	if (!TestTrue(TEXT("The units ticked"), Unregistered.AverageUnitTicks > 0.0)) return false;
+
+	const double SavedMs = Unregistered.AverageTickMs - Registered.AverageTickMs;
+	AddInfo(FString::Printf(TEXT("%d ticking units: world tick %.3f ms with every unit ticking (%.0f unit ticks per frame), %.3f ms with significance tiers (%.0f unit ticks per frame), %.3f ms saved per frame"),
+		NumUnits, Unregistered.AverageTickMs, Unregistered.AverageUnitTicks, Registered.AverageTickMs, Registered.AverageUnitTicks, SavedMs));
+
+	TestTrue(TEXT("Significance tiers reduce the unit ticks"), Registered.AverageUnitTicks < Unregistered.AverageUnitTicks);
+	TestTrue(FString::Printf(TEXT("Saved %.3f ms per frame"), SavedMs), SavedMs > 0.0);
+
+	return true;
+}
+
+#endif
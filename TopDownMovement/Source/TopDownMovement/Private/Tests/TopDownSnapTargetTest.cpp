@@ -0,0 +1,112 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Tests/TopDownTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Core/TopDownInputSource.h"
+#include "Core/TopDownPlayer.h"
+#include "Core/TopDownSelectableComponent.h"
+#include "Core/TopDownSelectionSubsystem.h"
+#include "Core/TopDownViewProjection.h"
+#include "Engine/World.h"
+
+/**
+ * 10k selectables packed around the point the camera looks at, and snap queries from cursor positions all over them.
+ * Fails when a query runs out of VirtualCursorSnapBudgetMs, takes longer than the budget, or returns anything but the
+ * selectable a brute force projection of every candidate finds nearest to the cursor.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTopDownSnapTargetTest, "TopDownMovement.SnapTarget", TOPDOWN_TEST_FLAGS | EAutomationTestFlags::PerfFilter)
+
+bool FTopDownSnapTargetTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumSelectables = 10000;
+	constexpr int32 NumQueries = 200;
+	constexpr float DenseRadius = 1500.0f;
+
+	FRandomStream RandomStream(31);
+	FTopDownTestWorld TestWorld;
+
+	ATopDownPlayer* Player = TestWorld.SpawnSyntheticPlayer(FVector::ZeroVector, RandomStream);
+	UTopDownSyntheticInputSource* Source = Player ? Cast<UTopDownSyntheticInputSource>(Player->GetInputSource()) : nullptr;
+	if (!TestNotNull(TEXT("Synthetic player"), Source)) return false;
+
+	// A still camera, so every query sees the same view
+	Source->SetScript(TArray<FTopDownSyntheticInputKey>());
+	Source->SetPointerPosition(FVector2D(Source->ViewportSize) * 0.5f);
+	TestWorld.Tick(1.0f / 60.0f);
+
+	const FTopDownViewProjection& Projection = Player->GetViewProjection();
+	FVector RayOrigin, RayDirection;
+	if (!TestTrue(TEXT("The view center deprojects"), Projection.DeprojectScreenToWorld(FVector2D(Source->ViewportSize) * 0.5f, RayOrigin, RayDirection) && RayDirection.Z < 0.0f)) return false;
+
+	const FVector ViewTarget = RayOrigin + RayDirection * (-RayOrigin.Z / RayDirection.Z);
+
+	TArray<AActor*> Selectables;
+	Selectables.Reserve(NumSelectables);
+	for (int32 Index = 0; Index < NumSelectables; ++Index)
+	{
+		const FVector2D Offset = FVector2D(RandomStream.VRand()).GetSafeNormal() * DenseRadius * FMath::Sqrt(RandomStream.FRand());
+		Selectables.Add(TestWorld.SpawnUnit(FVector(FVector2D(ViewTarget) + Offset, 0.0f), UTopDownSelectableComponent::StaticClass()));
+	}
+
+	const UTopDownSelectionSubsystem* SelectionSubsystem = TestWorld.GetWorld()->GetSubsystem<UTopDownSelectionSubsystem>();
+	if (!TestEqual(TEXT("Registered selectables"), SelectionSubsystem ? SelectionSubsystem->GetNumSelectables() : 0, NumSelectables)) return false;
+
+	const float SnapRadius = Player->GetVirtualCursorSnapRadius();
+	const double BudgetMs = Player->GetVirtualCursorSnapBudgetMs();
+
+	int32 NumExhausted = 0;
+	int32 NumWrong = 0;
+	int32 NumFound = 0;
+	double WorstMs = 0.0;
+	double TotalMs = 0.0;
+
+	for (int32 Query = 0; Query < NumQueries; ++Query)
+	{
+		// Cursor positions over the dense area
+		FVector2D CursorPos;
+		const FVector2D GroundPoint = FVector2D(ViewTarget) + FVector2D(RandomStream.VRand()).GetSafeNormal() * DenseRadius * RandomStream.FRand();
+		if (!Projection.ProjectWorldToScreen(FVector(GroundPoint, 0.0f), CursorPos)) continue;
+
+		bool bBudgetExhausted;
+		FVector2D TargetScreenPos;
+		const double StartTime = FPlatformTime::Seconds();
+		const AActor* SnapTarget = Player->FindSnapTarget(CursorPos, TargetScreenPos, &bBudgetExhausted);
+		const double QueryMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		TotalMs += QueryMs;
+		WorstMs = FMath::Max(WorstMs, QueryMs);
+		NumExhausted += bBudgetExhausted ? 1 : 0;
+		NumFound += SnapTarget ? 1 : 0;
+
+		const AActor* Nearest = nullptr;
+		double NearestDistanceSquared = FMath::Square(SnapRadius);
+		for (const AActor* Selectable : Selectables)
+		{
+			FVector2D ScreenPos;
+			if (!Projection.ProjectWorldToScreen(Selectable->GetActorLocation(), ScreenPos)) continue;
+
+			const double DistanceSquared = FVector2D::DistSquared(ScreenPos, CursorPos);
+			if (DistanceSquared <= NearestDistanceSquared)
+			{
+				Nearest = Selectable;
+				NearestDistanceSquared = DistanceSquared;
+			}
+		}
+
+		NumWrong += SnapTarget == Nearest ? 0 : 1;
+	}
+
+	AddInfo(FString::Printf(TEXT("%d selectables: %d queries, %d found a target, avg %.4f ms, worst %.4f ms against a %.3f ms budget"),
+		NumSelectables, NumQueries, NumFound, TotalMs / NumQueries, WorstMs, BudgetMs));
+
+	TestTrue(TEXT("Queries found targets"), NumFound > 0);
+	TestEqual(TEXT("Queries that ran out of their budget"), NumExhausted, 0);
+	TestEqual(TEXT("Queries that did not return the nearest selectable"), NumWrong, 0);
+	TestTrue(FString::Printf(TEXT("Worst query %.4f ms is within the %.3f ms budget"), WorstMs, BudgetMs), WorstMs <= BudgetMs);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,274 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Tests/TopDownTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Core/TopDownPlayer.h"
+#include "Core/TopDownSelectableComponent.h"
+#include "Core/TopDownSelectionSubsystem.h"
+#include "CoreGlobals.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTLS.h"
+#include "UObject/UObjectArray.h"
+
+static TAutoConsoleVariable<float> CVarTopDownSoakMinutes(
+	TEXT("TopDown.Soak.Minutes"),
+	30.0f,
+	TEXT("Simulated minutes played by the TopDownMovement.Soak automation test."));
+
+static TAutoConsoleVariable<int32> CVarTopDownSoakSelectables(
+	TEXT("TopDown.Soak.Selectables"),
+	10000,
+	TEXT("Selectable actors spawned by the TopDownMovement.Soak automation test."));
+
+static TAutoConsoleVariable<int32> CVarTopDownSoakSeed(
+	TEXT("TopDown.Soak.Seed"),
+	1337,
+	TEXT("Seed of the unit layout and input script of the TopDownMovement.Soak automation test."));
+
+static TAutoConsoleVariable<float> CVarTopDownSoakHitchMs(
+	TEXT("TopDown.Soak.HitchMs"),
+	33.3f,
+	TEXT("World tick duration in milliseconds above which a frame counts as a hitch."));
+
+static TAutoConsoleVariable<float> CVarTopDownSoakMaxHitchRate(
+	TEXT("TopDown.Soak.MaxHitchRate"),
+	0.002f,
+	TEXT("Fraction of hitching frames above which the soak test fails."));
+
+static TAutoConsoleVariable<float> CVarTopDownSoakMaxMemoryGrowthMB(
+	TEXT("TopDown.Soak.MaxMemoryGrowthMB"),
+	64.0f,
+	TEXT("Resident memory growth after warm up above which the soak test fails."));
+
+static TAutoConsoleVariable<int32> CVarTopDownSoakMaxObjectGrowth(
+	TEXT("TopDown.Soak.MaxObjectGrowth"),
+	64,
+	TEXT("UObject count growth after warm up and garbage collection above which the soak test fails."));
+
+static TAutoConsoleVariable<float> CVarTopDownSoakMaxAllocationsPerFrame(
+	TEXT("TopDown.Soak.MaxAllocationsPerFrame"),
+	100.0f,
+	TEXT("Average game thread heap allocations per world tick after warm up above which the soak test fails."));
+
+namespace TopDownSoakTest
+{
+	/**
+	 * Forwards to the allocator it replaces and counts the game thread allocations made while counting is on.
+	 * Short lived per call allocations are freed right away and never show up as memory growth, only as a count.
+	 */
+	class FCountingMalloc final : public FMalloc
+	{
+	public:
+		explicit FCountingMalloc(FMalloc* InInner) : Inner(InInner) {}
+
+		void SetCounting(bool bInCounting) { bCounting = bInCounting; }
+		uint64 GetNumAllocations() const { return NumAllocations; }
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation();
+			return Inner->Malloc(Count, Alignment);
+		}
+
+		virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation();
+			return Inner->TryMalloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			// Growing an array reallocates, which costs the same as a new allocation
+			if (Count > 0)
+			{
+				CountAllocation();
+			}
+			return Inner->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			if (Count > 0)
+			{
+				CountAllocation();
+			}
+			return Inner->TryRealloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override { Inner->Free(Original); }
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+		virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+		virtual void InitializeStatsMetadata() override { Inner->InitializeStatsMetadata(); }
+		virtual void UpdateStats() override { Inner->UpdateStats(); }
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+		virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+		virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+		virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+		virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+
+	private:
+		void CountAllocation()
+		{
+			if (bCounting && FPlatformTLS::GetCurrentThreadId() == GGameThreadId)
+			{
+				++NumAllocations;
+			}
+		}
+
+		FMalloc* Inner;
+		bool bCounting = false;
+		uint64 NumAllocations = 0;
+	};
+}
+
+/**
+ * Plays a seeded synthetic input script (edge scroll, drag, zoom sweeps, select, command) over thousands of moving selectables,
+ * timing every world tick and counting its game thread heap allocations. Fails on the hitch rate, on resident memory growth,
+ * on UObject growth after garbage collection and on the allocations per frame, which catch per call temporaries that
+ * are freed right away and never show up as memory growth.
+ * Meant for the nightly stress run: UnrealEditor-Cmd -nullrhi -ExecCmds="Automation RunTests TopDownMovement.Soak;Quit"
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTopDownSoakTest, "TopDownMovement.Soak", TOPDOWN_TEST_FLAGS | EAutomationTestFlags::StressFilter)
+
+bool FTopDownSoakTest::RunTest(const FString& Parameters)
+{
+	constexpr float DeltaSeconds = 1.0f / 60.0f;
+	constexpr int32 WarmUpFrames = 300;
+	constexpr int32 FramesPerMinute = 60 * 60;
+	constexpr float UnitSpreadRadius = 40000.0f;
+
+	const int32 NumFrames = FMath::Max(FMath::RoundToInt(CVarTopDownSoakMinutes.GetValueOnGameThread() * FramesPerMinute), 1);
+	const int32 NumSelectables = FMath::Max(CVarTopDownSoakSelectables.GetValueOnGameThread(), 1);
+	const double HitchMs = CVarTopDownSoakHitchMs.GetValueOnGameThread();
+
+	FRandomStream RandomStream(CVarTopDownSoakSeed.GetValueOnGameThread());
+	FTopDownTestWorld TestWorld;
+
+	TArray<AActor*> Units;
+	Units.Reserve(NumSelectables);
+	for (int32 Index = 0; Index < NumSelectables; ++Index)
+	{
+		const FVector2D Offset = FVector2D(RandomStream.VRand()).GetSafeNormal() * UnitSpreadRadius * FMath::Sqrt(RandomStream.FRand());
+		Units.Add(TestWorld.SpawnUnit(FVector(Offset, 0.0f), UTopDownSelectableComponent::StaticClass()));
+	}
+
+	ATopDownPlayer* Player = TestWorld.SpawnSyntheticPlayer(FVector::ZeroVector, RandomStream, 32);
+	if (!TestNotNull(TEXT("Synthetic player"), Player)) return false;
+
+	UTopDownSelectionSubsystem* SelectionSubsystem = TestWorld.GetWorld()->GetSubsystem<UTopDownSelectionSubsystem>();
+	TestEqual(TEXT("Registered selectables"), SelectionSubsystem ? SelectionSubsystem->GetNumSelectables() : 0, NumSelectables);
+
+	// A percent of the units wander every frame, so the selection grid and the group follow see moves
+	const int32 NumMovingPerFrame = FMath::Max(NumSelectables / 100, 1);
+	auto MoveUnits = [&]()
+	{
+		for (int32 Index = 0; Index < NumMovingPerFrame; ++Index)
+		{
+			AActor* Unit = Units[RandomStream.RandHelper(Units.Num())];
+			const FVector2D Step = FVector2D(RandomStream.VRand()).GetSafeNormal() * 50.0f;
+			const FVector2D NewLocation = FVector2D(Unit->GetActorLocation()) + Step;
+			Unit->SetActorLocation(FVector(NewLocation.Size() > UnitSpreadRadius ? NewLocation * 0.9f : NewLocation, 0.0f));
+		}
+	};
+
+	for (int32 Frame = 0; Frame < WarmUpFrames; ++Frame)
+	{
+		MoveUnits();
+		TestWorld.Tick(DeltaSeconds);
+	}
+
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	const uint64 BaselineMemory = FPlatformMemory::GetStats().UsedPhysical;
+	const int32 BaselineObjects = GUObjectArray.GetObjectArrayNumMinusAvailable();
+
+	static const double BucketLimitsMs[] = { 1.0, 2.0, 4.0, 8.0, 16.7, 33.3, 66.7 };
+	int32 Histogram[UE_ARRAY_COUNT(BucketLimitsMs) + 1] = {};
+	int32 NumHitches = 0;
+	double WorstFrameMs = 0.0;
+
+	// Installed for the timed ticks only, everything allocated before is freed through it by forwarding
+	FMalloc* InnerMalloc = GMalloc;
+	TopDownSoakTest::FCountingMalloc CountingMalloc(InnerMalloc);
+	GMalloc = &CountingMalloc;
+	uint64 MinuteStartAllocations = 0;
+
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		MoveUnits();
+
+		const double StartTime = FPlatformTime::Seconds();
+		CountingMalloc.SetCounting(true);
+		TestWorld.Tick(DeltaSeconds);
+		CountingMalloc.SetCounting(false);
+		const double FrameMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		int32 Bucket = 0;
+		while (Bucket < UE_ARRAY_COUNT(BucketLimitsMs) && FrameMs > BucketLimitsMs[Bucket])
+		{
+			++Bucket;
+		}
+		++Histogram[Bucket];
+
+		NumHitches += FrameMs > HitchMs ? 1 : 0;
+		WorstFrameMs = FMath::Max(WorstFrameMs, FrameMs);
+
+		// Collected outside the timed tick, so leaked objects show up in the object count and not as hitches
+		if ((Frame + 1) % FramesPerMinute == 0)
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+			AddInfo(FString::Printf(TEXT("Minute %d: resident %.1f MB (%+.1f MB), %d objects (%+d), %d hitches, %.1f allocations per frame"),
+				(Frame + 1) / FramesPerMinute,
+				FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0),
+				(int64(FPlatformMemory::GetStats().UsedPhysical) - int64(BaselineMemory)) / (1024.0 * 1024.0),
+				GUObjectArray.GetObjectArrayNumMinusAvailable(),
+				GUObjectArray.GetObjectArrayNumMinusAvailable() - BaselineObjects,
+				NumHitches,
+				double(CountingMalloc.GetNumAllocations() - MinuteStartAllocations) / FramesPerMinute));
+			MinuteStartAllocations = CountingMalloc.GetNumAllocations();
+		}
+	}
+
+	GMalloc = InnerMalloc;
+	const double AllocationsPerFrame = double(CountingMalloc.GetNumAllocations()) / NumFrames;
+
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	const double MemoryGrowthMB = (int64(FPlatformMemory::GetStats().UsedPhysical) - int64(BaselineMemory)) / (1024.0 * 1024.0);
+	const int32 ObjectGrowth = GUObjectArray.GetObjectArrayNumMinusAvailable() - BaselineObjects;
+	const double HitchRate = double(NumHitches) / NumFrames;
+
+	for (int32 Bucket = 0; Bucket < UE_ARRAY_COUNT(Histogram); ++Bucket)
+	{
+		const double LowerMs = Bucket > 0 ? BucketLimitsMs[Bucket - 1] : 0.0;
+		if (Bucket < UE_ARRAY_COUNT(BucketLimitsMs))
+		{
+			AddInfo(FString::Printf(TEXT("%5.1f - %5.1f ms: %d frames"), LowerMs, BucketLimitsMs[Bucket], Histogram[Bucket]));
+		}
+		else
+		{
+			AddInfo(FString::Printf(TEXT("%5.1f ms and more: %d frames"), LowerMs, Histogram[Bucket]));
+		}
+	}
+	AddInfo(FString::Printf(TEXT("%d frames, %d hitches above %.1f ms (%.3f%%), worst %.2f ms, memory growth %.1f MB, object growth %d, %.1f allocations per frame"),
+		NumFrames, NumHitches, HitchMs, HitchRate * 100.0, WorstFrameMs, MemoryGrowthMB, ObjectGrowth, AllocationsPerFrame));
+
+	TestTrue(FString::Printf(TEXT("Hitch rate %.3f%% is within %.3f%%"), HitchRate * 100.0, CVarTopDownSoakMaxHitchRate.GetValueOnGameThread() * 100.0),
+		HitchRate <= CVarTopDownSoakMaxHitchRate.GetValueOnGameThread());
+	TestTrue(FString::Printf(TEXT("Memory growth %.1f MB is within %.1f MB"), MemoryGrowthMB, CVarTopDownSoakMaxMemoryGrowthMB.GetValueOnGameThread()),
+		MemoryGrowthMB <= CVarTopDownSoakMaxMemoryGrowthMB.GetValueOnGameThread());
+	TestTrue(FString::Printf(TEXT("Object growth %d is within %d"), ObjectGrowth, CVarTopDownSoakMaxObjectGrowth.GetValueOnGameThread()),
+		ObjectGrowth <= CVarTopDownSoakMaxObjectGrowth.GetValueOnGameThread());
+	TestTrue(FString::Printf(TEXT("%.1f allocations per frame are within %.1f"), AllocationsPerFrame, CVarTopDownSoakMaxAllocationsPerFrame.GetValueOnGameThread()),
+		AllocationsPerFrame <= CVarTopDownSoakMaxAllocationsPerFrame.GetValueOnGameThread());
+
+	return true;
+}
+
+#endif
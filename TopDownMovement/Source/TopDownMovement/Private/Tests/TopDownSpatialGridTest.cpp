@@ -0,0 +1,76 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Tests/TopDownTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Core/TopDownSpatialGrid.h"
+
+/**
+ * Random adds, moves and removals checked against a plain map of the expected locations.
+ * Catches stale in-cell indices after swap removals, which would otherwise only show up as lost or duplicated elements.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTopDownSpatialGridTest, "TopDownMovement.SpatialGrid", TOPDOWN_TEST_FLAGS | EAutomationTestFlags::EngineFilter)
+
+bool FTopDownSpatialGridTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumElements = 2000;
+	constexpr int32 NumOperations = 50000;
+	constexpr float Extent = 20000.0f;
+
+	FRandomStream RandomStream(3);
+	TTopDownSpatialGrid<int32> Grid(1000.0f);
+	TMap<int32, FVector> Expected;
+
+	auto RandomLocation = [&RandomStream]()
+	{
+		return FVector(RandomStream.FRandRange(-Extent, Extent), RandomStream.FRandRange(-Extent, Extent), 0.0f);
+	};
+
+	for (int32 Operation = 0; Operation < NumOperations; ++Operation)
+	{
+		const int32 Element = RandomStream.RandHelper(NumElements);
+		const float Roll = RandomStream.FRand();
+
+		if (Roll < 0.2f)
+		{
+			Grid.Remove(Element);
+			Expected.Remove(Element);
+		}
+		else
+		{
+			// Mostly small steps inside the cell, sometimes across a border or anywhere
+			const FVector* Current = Expected.Find(Element);
+			const FVector Location = Current && Roll < 0.8f ? *Current + FVector(RandomStream.FRandRange(-300.0f, 300.0f), RandomStream.FRandRange(-300.0f, 300.0f), 0.0f) : RandomLocation();
+			Grid.Add(Element, Location);
+			Expected.Add(Element, Location);
+		}
+	}
+
+	TestEqual(TEXT("Element count"), Grid.Num(), Expected.Num());
+
+	int32 NumVisited = 0;
+	Grid.ForEachInBox(FBox2D(FVector2D(-Extent * 2.0f), FVector2D(Extent * 2.0f)), [&](const TTopDownSpatialGrid<int32>::FEntry& Entry)
+	{
+		++NumVisited;
+
+		const FVector* Location = Expected.Find(Entry.Element);
+		if (!Location)
+		{
+			AddError(FString::Printf(TEXT("Removed element %d is still in a cell"), Entry.Element));
+			return true;
+		}
+
+		TestEqual(TEXT("Entry location"), Entry.Location, *Location);
+
+		const FIntPoint* Cell = Grid.FindElementCell(Entry.Element);
+		TestTrue(TEXT("Entry is in the cell of its location"), Cell && *Cell == Grid.GetCell(*Location));
+		return true;
+	});
+
+	TestEqual(TEXT("Every element is in exactly one cell"), NumVisited, Expected.Num());
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,178 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Tests/TopDownTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Core/TopDownInputSource.h"
+#include "Core/TopDownPlayer.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarTopDownStreamingTestLoadSeconds(
+	TEXT("TopDown.StreamingTest.LoadSeconds"),
+	0.5f,
+	TEXT("Seconds a generated cell of the TopDownMovement.Streaming test takes to load once a streaming shape requests it."));
+
+static TAutoConsoleVariable<float> CVarTopDownStreamingTestPanSeconds(
+	TEXT("TopDown.StreamingTest.PanSeconds"),
+	20.0f,
+	TEXT("Seconds of full speed edge scrolling played by the TopDownMovement.Streaming test."));
+
+namespace TopDownStreamingTest
+{
+	/** Grid cell size of the default world partition runtime grid */
+	constexpr float CellSize = 12800.0f;
+
+	FIntPoint ToCell(const FVector2D& Location)
+	{
+		return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+	}
+
+	struct FPanResult
+	{
+		int32 NumFrames = 0;
+		int32 NumHitchFrames = 0;
+		int32 NumRequestedCells = 0;
+		float MaxViewSpeed = 0.0f;
+	};
+
+	/**
+	 * Edge scrolls a synthetic player at full zoom out over an endless generated grid of cells. A cell starts loading once
+	 * one of the player's streaming shapes touches it and is loaded LoadSeconds later. Every frame the ground footprint
+	 * overlaps a cell that is not loaded yet counts as a streaming hitch.
+	 */
+	FPanResult Pan(bool bPredict, float LoadSeconds, float PanSeconds)
+	{
+		constexpr float DeltaSeconds = 1.0f / 60.0f;
+		constexpr int32 ZoomOutFrames = 180;
+
+		FPanResult Result;
+
+		FTopDownTestWorld TestWorld;
+		FRandomStream RandomStream(11);
+
+		ATopDownPlayer* Player = TestWorld.SpawnSyntheticPlayer(FVector::ZeroVector, RandomStream);
+		UTopDownSyntheticInputSource* Source = Player ? Cast<UTopDownSyntheticInputSource>(Player->GetInputSource()) : nullptr;
+		if (!Source) return Result;
+
+		// Pointer at the center while zooming out, so the camera only starts moving with the pan
+		Source->SetScript(TArray<FTopDownSyntheticInputKey>());
+		Source->SetPointerPosition(FVector2D(Source->ViewportSize) * 0.5f);
+
+		TMap<FIntPoint, double> CellRequestTimes;
+		double Time = 0.0;
+
+		auto StepFrame = [&](bool bMeasure)
+		{
+			TestWorld.Tick(DeltaSeconds);
+			Time += DeltaSeconds;
+
+			TArray<FWorldPartitionStreamingSource> StreamingSources;
+			Player->GetStreamingSources(StreamingSources);
+
+			for (const FWorldPartitionStreamingSource& StreamingSource : StreamingSources)
+			{
+				// The first shape covers the current footprint, the ones after it are the prediction
+				const int32 NumShapes = bPredict ? StreamingSource.Shapes.Num() : FMath::Min(StreamingSource.Shapes.Num(), 1);
+				for (int32 ShapeIndex = 0; ShapeIndex < NumShapes; ++ShapeIndex)
+				{
+					const FStreamingSourceShape& Shape = StreamingSource.Shapes[ShapeIndex];
+					const FVector2D ShapeCenter = FVector2D(StreamingSource.Location + Shape.Location);
+					const FIntPoint MinCell = ToCell(ShapeCenter - Shape.Radius);
+					const FIntPoint MaxCell = ToCell(ShapeCenter + Shape.Radius);
+
+					for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+					{
+						for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+						{
+							const FBox2D CellBox(FVector2D(CellX, CellY) * CellSize, FVector2D(CellX + 1, CellY + 1) * CellSize);
+							if (CellBox.ComputeSquaredDistanceToPoint(ShapeCenter) <= FMath::Square(Shape.Radius))
+							{
+								CellRequestTimes.FindOrAdd(FIntPoint(CellX, CellY), Time);
+							}
+						}
+					}
+				}
+			}
+
+			const FTopDownGroundFootprint& Footprint = Player->GetGroundFootprint();
+			if (!bMeasure || !Footprint.bIsValid) return;
+
+			++Result.NumFrames;
+			Result.MaxViewSpeed = FMath::Max(Result.MaxViewSpeed, float(Player->GetStreamingViewVelocity().Size2D()));
+
+			const FIntPoint MinCell = ToCell(Footprint.Bounds.Min);
+			const FIntPoint MaxCell = ToCell(Footprint.Bounds.Max);
+			for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+			{
+				for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+				{
+					const FBox2D CellBox(FVector2D(CellX, CellY) * CellSize, FVector2D(CellX + 1, CellY + 1) * CellSize);
+					if (!Footprint.IntersectsBox(CellBox)) continue;
+
+					const double* RequestTime = CellRequestTimes.Find(FIntPoint(CellX, CellY));
+					if (!RequestTime || Time < *RequestTime + LoadSeconds)
+					{
+						++Result.NumHitchFrames;
+						return;
+					}
+				}
+			}
+		};
+
+		for (int32 Frame = 0; Frame < ZoomOutFrames; ++Frame)
+		{
+			Player->SimulateAction(ETopDownSimulatedAction::ZoomOut, ETriggerEvent::Triggered);
+			StepFrame(false);
+		}
+		Player->SimulateAction(ETopDownSimulatedAction::ZoomOut, ETriggerEvent::Completed);
+
+		// Let the cells around the start finish loading before the pan
+		const int32 SettleFrames = FMath::CeilToInt(LoadSeconds / DeltaSeconds) + 1;
+		for (int32 Frame = 0; Frame < SettleFrames; ++Frame)
+		{
+			StepFrame(false);
+		}
+
+		// Right edge, full edge scrolling strength
+		Source->SetPointerPosition(FVector2D(Source->ViewportSize.X - 1, Source->ViewportSize.Y / 2));
+
+		const int32 PanFrames = FMath::Max(FMath::RoundToInt(PanSeconds / DeltaSeconds), 1);
+		for (int32 Frame = 0; Frame < PanFrames; ++Frame)
+		{
+			StepFrame(true);
+		}
+
+		Result.NumRequestedCells = CellRequestTimes.Num();
+		return Result;
+	}
+}
+
+/**
+ * Streaming hitches while edge scrolling at full zoom out across a generated grid of cells, with and without the predicted shape.
+ * Cell loading is modeled with a fixed latency, so the test needs no world partition map and runs headless.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTopDownStreamingTest, "TopDownMovement.Streaming", TOPDOWN_TEST_FLAGS | EAutomationTestFlags::PerfFilter)
+
+bool FTopDownStreamingTest::RunTest(const FString& Parameters)
+{
+	using namespace TopDownStreamingTest;
+
+	const float LoadSeconds = FMath::Max(CVarTopDownStreamingTestLoadSeconds.GetValueOnGameThread(), 0.0f);
+	const float PanSeconds = FMath::Max(CVarTopDownStreamingTestPanSeconds.GetValueOnGameThread(), 1.0f);
+
+	const FPanResult Baseline = Pan(false, LoadSeconds, PanSeconds);
+	const FPanResult Predicted = Pan(true, LoadSeconds, PanSeconds);
+
+	if (!TestTrue(TEXT("The synthetic player measured the pan"), Baseline.NumFrames > 0 && Predicted.NumFrames > 0)) return false;
+
+	AddInfo(FString::Printf(TEXT("Without prediction: %d of %d frames hitched, %d cells requested"), Baseline.NumHitchFrames, Baseline.NumFrames, Baseline.NumRequestedCells));
+	AddInfo(FString::Printf(TEXT("With prediction: %d of %d frames hitched, %d cells requested, view speed up to %.0f"), Predicted.NumHitchFrames, Predicted.NumFrames, Predicted.NumRequestedCells, Predicted.MaxViewSpeed));
+
+	TestTrue(TEXT("The view center velocity follows edge scrolling"), Predicted.MaxViewSpeed > 0.0f);
+	TestTrue(TEXT("The predicted shape removes streaming hitches"), Predicted.NumHitchFrames < Baseline.NumHitchFrames || Baseline.NumHitchFrames == 0);
+
+	return true;
+}
+
+#endif
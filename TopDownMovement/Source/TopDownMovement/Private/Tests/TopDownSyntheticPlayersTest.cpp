@@ -0,0 +1,134 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Tests/TopDownTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Core/TopDownPlayer.h"
+#include "Core/TopDownRelevancySubsystem.h"
+#include "Core/TopDownSelectableComponent.h"
+#include "Core/TopDownSelectionSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Controller.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarTopDownSyntheticPlayersCount(
+	TEXT("TopDown.SyntheticPlayersTest.Players"),
+	128,
+	TEXT("Synthetic players spawned by the TopDownMovement.SyntheticPlayers test."));
+
+static TAutoConsoleVariable<float> CVarTopDownSyntheticPlayersSeconds(
+	TEXT("TopDown.SyntheticPlayersTest.Seconds"),
+	60.0f,
+	TEXT("Simulated seconds played by the TopDownMovement.SyntheticPlayers test."));
+
+static TAutoConsoleVariable<float> CVarTopDownSyntheticPlayersMaxFrameMs(
+	TEXT("TopDown.SyntheticPlayersTest.MaxFrameMs"),
+	16.7f,
+	TEXT("Average world tick time in milliseconds above which the TopDownMovement.SyntheticPlayers test fails."));
+
+static TAutoConsoleVariable<float> CVarTopDownSyntheticPlayersMaxP99Ms(
+	TEXT("TopDown.SyntheticPlayersTest.MaxP99Ms"),
+	33.3f,
+	TEXT("99th percentile world tick time in milliseconds above which the TopDownMovement.SyntheticPlayers test fails."));
+
+/**
+ * Load test of the movement, selection and relevancy paths: 100+ synthetic players in one headless process, each playing
+ * a random input script (edge scroll, select, command, zoom) over a field of selectables and publishing its camera interest.
+ * Fails when the average or 99th percentile world tick exceeds its budget, or when a player stopped publishing.
+ * UnrealEditor-Cmd -nullrhi -ExecCmds="Automation RunTests TopDownMovement.SyntheticPlayers;Quit"
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTopDownSyntheticPlayersTest, "TopDownMovement.SyntheticPlayers", TOPDOWN_TEST_FLAGS | EAutomationTestFlags::StressFilter)
+
+bool FTopDownSyntheticPlayersTest::RunTest(const FString& Parameters)
+{
+	constexpr float DeltaSeconds = 1.0f / 60.0f;
+	constexpr int32 WarmUpFrames = 120;
+	constexpr int32 NumSelectables = 5000;
+	constexpr float SpreadRadius = 40000.0f;
+
+	const int32 NumPlayers = FMath::Max(CVarTopDownSyntheticPlayersCount.GetValueOnGameThread(), 1);
+	const int32 NumFrames = FMath::Max(FMath::RoundToInt(CVarTopDownSyntheticPlayersSeconds.GetValueOnGameThread() / DeltaSeconds), 1);
+
+	FRandomStream RandomStream(23);
+	FTopDownTestWorld TestWorld;
+
+	auto RandomLocation = [&RandomStream]()
+	{
+		return FVector(FVector2D(RandomStream.VRand()).GetSafeNormal() * SpreadRadius * FMath::Sqrt(RandomStream.FRand()), 0.0f);
+	};
+
+	UTopDownRelevancySubsystem* Relevancy = TestWorld.GetWorld()->GetSubsystem<UTopDownRelevancySubsystem>();
+	UTopDownSelectionSubsystem* SelectionSubsystem = TestWorld.GetWorld()->GetSubsystem<UTopDownSelectionSubsystem>();
+	if (!TestNotNull(TEXT("Relevancy subsystem"), Relevancy) || !TestNotNull(TEXT("Selection subsystem"), SelectionSubsystem)) return false;
+
+	// The test world is standalone, where UTopDownRelevancyComponent does not register, so the units are registered directly
+	for (int32 Index = 0; Index < NumSelectables; ++Index)
+	{
+		AActor* Unit = TestWorld.SpawnUnit(RandomLocation(), UTopDownSelectableComponent::StaticClass());
+		Relevancy->RegisterActor(Unit);
+	}
+
+	TArray<ATopDownPlayer*> Players;
+	Players.Reserve(NumPlayers);
+	for (int32 Index = 0; Index < NumPlayers; ++Index)
+	{
+		if (ATopDownPlayer* Player = TestWorld.SpawnSyntheticPlayer(RandomLocation(), RandomStream, RandomStream.RandRange(4, 8)))
+		{
+			Players.Add(Player);
+		}
+	}
+	if (!TestEqual(TEXT("Synthetic players"), Players.Num(), NumPlayers)) return false;
+
+	for (int32 Frame = 0; Frame < WarmUpFrames; ++Frame)
+	{
+		TestWorld.Tick(DeltaSeconds);
+	}
+
+	TArray<FVector> StartLocations;
+	for (const ATopDownPlayer* Player : Players)
+	{
+		StartLocations.Add(Player->GetActorLocation());
+	}
+
+	TArray<double> FrameTimesMs;
+	FrameTimesMs.Reserve(NumFrames);
+	double TotalMs = 0.0;
+
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		TestWorld.Tick(DeltaSeconds);
+		const double FrameMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		FrameTimesMs.Add(FrameMs);
+		TotalMs += FrameMs;
+	}
+
+	int32 NumPublishing = 0;
+	int32 NumMoved = 0;
+	for (int32 Index = 0; Index < Players.Num(); ++Index)
+	{
+		FTopDownCameraInterest Interest;
+		NumPublishing += Relevancy->GetViewerInterest(Players[Index]->GetController(), Interest) ? 1 : 0;
+		NumMoved += FVector::Dist2D(Players[Index]->GetActorLocation(), StartLocations[Index]) > 1.0f ? 1 : 0;
+	}
+
+	FrameTimesMs.Sort();
+	const double AverageMs = TotalMs / NumFrames;
+	const double P99Ms = FrameTimesMs[FMath::Min(FMath::FloorToInt(NumFrames * 0.99), NumFrames - 1)];
+	const float MaxFrameMs = CVarTopDownSyntheticPlayersMaxFrameMs.GetValueOnGameThread();
+	const float MaxP99Ms = CVarTopDownSyntheticPlayersMaxP99Ms.GetValueOnGameThread();
+
+	AddInfo(FString::Printf(TEXT("%d players, %d selectables, %d frames: average %.2f ms (%.3f ms per player), p99 %.2f ms, worst %.2f ms, %d players moved"),
+		Players.Num(), NumSelectables, NumFrames, AverageMs, AverageMs / Players.Num(), P99Ms, FrameTimesMs.Last(), NumMoved));
+
+	TestEqual(TEXT("Players publishing their camera interest"), NumPublishing, Players.Num());
+	TestTrue(TEXT("The input scripts moved the players"), NumMoved > 0);
+	TestTrue(FString::Printf(TEXT("Average tick %.2f ms is within %.2f ms"), AverageMs, MaxFrameMs), AverageMs <= MaxFrameMs);
+	TestTrue(FString::Printf(TEXT("p99 tick %.2f ms is within %.2f ms"), P99Ms, MaxP99Ms), P99Ms <= MaxP99Ms);
+
+	return true;
+}
+
+#endif
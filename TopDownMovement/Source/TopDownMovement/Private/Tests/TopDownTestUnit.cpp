@@ -0,0 +1,32 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Tests/TopDownTestUnit.h"
+#include "Components/SceneComponent.h"
+
+ATopDownTestUnit::ATopDownTestUnit()
+{
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = true;
+
+	USceneComponent* UnitRoot = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+	UnitRoot->SetMobility(EComponentMobility::Movable);
+	SetRootComponent(UnitRoot);
+
+	TickWorkIterations = 256;
+	NumTicks = 0;
+	TickWorkResult = 0.0f;
+}
+
+void ATopDownTestUnit::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	++NumTicks;
+
+	float Value = TickWorkResult + DeltaSeconds;
+	for (int32 Iteration = 0; Iteration < TickWorkIterations; ++Iteration)
+	{
+		Value = FMath::Sin(Value) * 0.5f + FMath::Cos(Value * 1.3f) * 0.5f;
+	}
+	TickWorkResult = Value;
+}
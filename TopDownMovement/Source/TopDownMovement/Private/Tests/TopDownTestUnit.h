@@ -0,0 +1,31 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "TopDownTestUnit.generated.h"
+
+/**
+ * Unit for automation tests with a fixed, real game thread cost per tick, standing in for gameplay logic.
+ * Spawned through FTopDownTestWorld::SpawnTickingUnit, not meant to be placed in levels.
+ */
+UCLASS(NotBlueprintable, NotPlaceable, Transient, HideDropdown)
+class ATopDownTestUnit : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	ATopDownTestUnit();
+
+	virtual void Tick(float DeltaSeconds) override;
+
+	/** Iterations of arithmetic work done on every tick */
+	int32 TickWorkIterations;
+
+	int32 NumTicks;
+
+private:
+	/** Result of the tick work, kept so the work is not optimized away */
+	float TickWorkResult;
+};
@@ -0,0 +1,117 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Tests/TopDownTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Core/TopDownPlayer.h"
+#include "Core/TopDownInputSource.h"
+#include "Tests/TopDownTestUnit.h"
+#include "Components/SceneComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Containers/Ticker.h"
+#include "Tickable.h"
+
+FTopDownTestWorld::FTopDownTestWorld()
+{
+	World = UWorld::CreateWorld(EWorldType::Game, false);
+
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	// The game mode routes BeginPlay, actors spawned afterwards begin play right away
+	const FURL URL;
+	World->SetGameMode(URL);
+	World->InitializeActorsForPlay(URL);
+	World->BeginPlay();
+}
+
+FTopDownTestWorld::~FTopDownTestWorld()
+{
+	World->BeginTearingDown();
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+}
+
+void FTopDownTestWorld::Tick(float DeltaSeconds)
+{
+	World->Tick(LEVELTICK_All, DeltaSeconds);
+
+	FTickableGameObject::TickObjects(World, LEVELTICK_All, false, DeltaSeconds);
+	FTSTicker::GetCoreTicker().Tick(DeltaSeconds);
+
+	++GFrameCounter;
+}
+
+AActor* FTopDownTestWorld::SpawnUnit(const FVector& Location, TSubclassOf<UActorComponent> ComponentClass)
+{
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AActor* Unit = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(Location), SpawnParameters);
+	if (!Unit) return nullptr;
+
+	USceneComponent* UnitRoot = NewObject<USceneComponent>(Unit, TEXT("Root"));
+	UnitRoot->SetMobility(EComponentMobility::Movable);
+	UnitRoot->SetWorldLocation(Location);
+	Unit->SetRootComponent(UnitRoot);
+	Unit->AddInstanceComponent(UnitRoot);
+	UnitRoot->RegisterComponent();
+
+	// Registered after the root, so the component finds it in BeginPlay
+	if (ComponentClass)
+	{
+		UActorComponent* Component = NewObject<UActorComponent>(Unit, ComponentClass);
+		Unit->AddInstanceComponent(Component);
+		Component->RegisterComponent();
+	}
+
+	return Unit;
+}
+
+ATopDownTestUnit* FTopDownTestWorld::SpawnTickingUnit(const FVector& Location, int32 TickWorkIterations)
+{
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	ATopDownTestUnit* Unit = World->SpawnActor<ATopDownTestUnit>(ATopDownTestUnit::StaticClass(), FTransform(Location), SpawnParameters);
+	if (Unit)
+	{
+		Unit->TickWorkIterations = TickWorkIterations;
+	}
+	return Unit;
+}
+
+ATopDownPlayer* FTopDownTestWorld::SpawnSyntheticPlayer(const FVector& Location, FRandomStream& RandomStream, int32 NumScriptKeys)
+{
+	TSubclassOf<ATopDownPlayer> PlayerClass = LoadClass<ATopDownPlayer>(nullptr, TEXT("/TopDownMovement/BP_Player.BP_Player_C"), nullptr, LOAD_NoWarn | LOAD_Quiet);
+	if (!PlayerClass)
+	{
+		PlayerClass = ATopDownPlayer::StaticClass();
+	}
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	ATopDownPlayer* SyntheticPlayer = World->SpawnActor<ATopDownPlayer>(PlayerClass, FTransform(Location), SpawnParameters);
+	if (!SyntheticPlayer) return nullptr;
+
+	UTopDownSyntheticInputSource* Source = NewObject<UTopDownSyntheticInputSource>(SyntheticPlayer);
+
+	TArray<FTopDownSyntheticInputKey> Script;
+	UTopDownSyntheticInputSource::MakeRandomScript(RandomStream, Source->ViewportSize, NumScriptKeys, Script);
+	Source->SetScript(Script);
+
+	SyntheticPlayer->SetInputSource(Source);
+
+	// The input path only runs for locally controlled pawns
+	SyntheticPlayer->SpawnDefaultController();
+
+	return SyntheticPlayer;
+}
+
+#endif
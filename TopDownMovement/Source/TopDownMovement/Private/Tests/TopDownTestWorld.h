@@ -0,0 +1,50 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+class UWorld;
+class AActor;
+class UActorComponent;
+class ATopDownPlayer;
+class ATopDownTestUnit;
+
+/** Contexts shared by the plugin's automation tests, they need no viewport and run headless with -nullrhi. */
+#define TOPDOWN_TEST_FLAGS (EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext)
+
+/**
+ * Standalone game world for automation tests, begun on construction and destroyed with the object.
+ * Tick advances GFrameCounter, the core ticker and the tickable objects like the engine loop does,
+ * so per-frame caches and streamed assets behave as they do in game.
+ */
+class FTopDownTestWorld
+{
+public:
+	FTopDownTestWorld();
+	~FTopDownTestWorld();
+
+	UWorld* GetWorld() const { return World; }
+
+	void Tick(float DeltaSeconds);
+
+	/** Movable actor with a scene root, and an optional component such as UTopDownSelectableComponent registered on it. */
+	AActor* SpawnUnit(const FVector& Location, TSubclassOf<UActorComponent> ComponentClass = nullptr);
+
+	/** ATopDownTestUnit, ticking every frame with TickWorkIterations of arithmetic work. */
+	ATopDownTestUnit* SpawnTickingUnit(const FVector& Location, int32 TickWorkIterations = 256);
+
+	/**
+	 * SpawnSyntheticPlayer - AI possessed player driven by a UTopDownSyntheticInputSource::MakeRandomScript script.
+	 * Uses the plugin's BP_Player when it can be loaded, so the zoom curve and input data are those of the shipped content.
+	 */
+	ATopDownPlayer* SpawnSyntheticPlayer(const FVector& Location, FRandomStream& RandomStream, int32 NumScriptKeys = 8);
+
+private:
+	UWorld* World;
+};
+
+#endif
@@ -0,0 +1,127 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Tests/TopDownTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Core/TopDownViewProjection.h"
+#include "Camera/CameraTypes.h"
+
+namespace TopDownViewProjectionTest
+{
+	struct FProjectionResult
+	{
+		double BatchSeconds = 0.0;
+		double ScalarSeconds = 0.0;
+		float MaxPixelError = 0.0f;
+		int32 NumVisibilityMismatches = 0;
+		int32 NumVisible = 0;
+	};
+
+	/**
+	 * Projects NumPoints random ground positions around ViewTarget with the batched path and with the double precision
+	 * single point path, timing both and comparing the screen positions of the points visible to both.
+	 */
+	FProjectionResult Project(const FVector& ViewTarget, int32 NumPoints, int32 NumRepeats)
+	{
+		FProjectionResult Result;
+
+		FMinimalViewInfo ViewInfo;
+		ViewInfo.Location = ViewTarget + FVector(-1500.0f, 0.0f, 2500.0f);
+		ViewInfo.Rotation = FRotator(-60.0f, 0.0f, 0.0f);
+		ViewInfo.FOV = 90.0f;
+
+		FTopDownViewProjection Projection;
+		Projection.Capture(ViewInfo, FIntPoint(1920, 1080));
+
+		FRandomStream RandomStream(7);
+		TArray<FVector> Locations;
+		Locations.Reserve(NumPoints);
+		for (int32 Index = 0; Index < NumPoints; ++Index)
+		{
+			Locations.Add(ViewTarget + FVector(RandomStream.FRandRange(-6000.0f, 6000.0f), RandomStream.FRandRange(-6000.0f, 6000.0f), 0.0f));
+		}
+
+		FTopDownWorldPoints WorldPoints;
+		FTopDownScreenPoints ScreenPoints;
+		WorldPoints.Reset(NumPoints, Projection.GetViewOrigin());
+		for (const FVector& Location : Locations)
+		{
+			WorldPoints.Add(Location);
+		}
+
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Repeat = 0; Repeat < NumRepeats; ++Repeat)
+		{
+			Projection.ProjectPoints(WorldPoints, ScreenPoints);
+		}
+		Result.BatchSeconds = (FPlatformTime::Seconds() - StartTime) / NumRepeats;
+
+		TArray<FVector2D> ScalarPositions;
+		TArray<bool> ScalarVisible;
+		ScalarPositions.SetNumUninitialized(NumPoints);
+		ScalarVisible.SetNumUninitialized(NumPoints);
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Repeat = 0; Repeat < NumRepeats; ++Repeat)
+		{
+			for (int32 Index = 0; Index < NumPoints; ++Index)
+			{
+				ScalarVisible[Index] = Projection.ProjectWorldToScreen(Locations[Index], ScalarPositions[Index]);
+			}
+		}
+		Result.ScalarSeconds = (FPlatformTime::Seconds() - StartTime) / NumRepeats;
+
+		for (int32 Index = 0; Index < NumPoints; ++Index)
+		{
+			const bool bVisible = ScreenPoints.Visible[Index] != 0;
+			if (bVisible != ScalarVisible[Index])
+			{
+				// Points on the viewport border may round either way
+				const FVector2D& Position = ScalarPositions[Index];
+				const bool bOnBorder = FMath::Abs(Position.X) < 1.0 || FMath::Abs(Position.X - 1920.0) < 1.0 || FMath::Abs(Position.Y) < 1.0 || FMath::Abs(Position.Y - 1080.0) < 1.0;
+				Result.NumVisibilityMismatches += bOnBorder ? 0 : 1;
+				continue;
+			}
+			if (!bVisible) continue;
+
+			++Result.NumVisible;
+			const FVector2D BatchPosition(ScreenPoints.X[Index], ScreenPoints.Y[Index]);
+			Result.MaxPixelError = FMath::Max(Result.MaxPixelError, float(FVector2D::Distance(BatchPosition, ScalarPositions[Index])));
+		}
+
+		return Result;
+	}
+}
+
+/**
+ * 50k ground points projected with FTopDownViewProjection::ProjectPoints against the double precision single point path,
+ * once near the world origin and once ten million units away from it, where float world positions would be off by meters.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTopDownViewProjectionTest, "TopDownMovement.ViewProjection", TOPDOWN_TEST_FLAGS | EAutomationTestFlags::PerfFilter)
+
+bool FTopDownViewProjectionTest::RunTest(const FString& Parameters)
+{
+	using namespace TopDownViewProjectionTest;
+
+	constexpr int32 NumPoints = 50000;
+	constexpr int32 NumRepeats = 20;
+	constexpr float MaxPixelError = 1.0f;
+
+	const FVector ViewTargets[] = { FVector::ZeroVector, FVector(1.0e7, -1.0e7, 0.0) };
+	for (const FVector& ViewTarget : ViewTargets)
+	{
+		const FProjectionResult Result = Project(ViewTarget, NumPoints, NumRepeats);
+
+		AddInfo(FString::Printf(TEXT("View at %s: %d points, batched %.3f ms, single point %.3f ms, %d visible, max error %.4f px"),
+			*ViewTarget.ToCompactString(), NumPoints, Result.BatchSeconds * 1000.0, Result.ScalarSeconds * 1000.0, Result.NumVisible, Result.MaxPixelError));
+
+		TestTrue(TEXT("Points are visible"), Result.NumVisible > 0);
+		TestEqual(TEXT("Points visible in only one path"), Result.NumVisibilityMismatches, 0);
+		TestTrue(FString::Printf(TEXT("Max error %.4f px is within %.1f px"), Result.MaxPixelError, MaxPixelError), Result.MaxPixelError <= MaxPixelError);
+	}
+
+	return true;
+}
+
+#endif
@@ -4,10 +4,12 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
+#include "UObject/SoftObjectPtr.h"
 #include "InputDataSetup.generated.h"
 
 class UInputAction;
 
+/** Input actions bound by ATopDownPlayer. Actions are soft referenced and streamed by the player once this asset is loaded. */
 UCLASS(BlueprintType)
 class TOPDOWNMOVEMENT_API UInputDataSetup : public UDataAsset
 {
@@ -15,18 +17,29 @@ class TOPDOWNMOVEMENT_API UInputDataSetup : public UDataAsset
 	
 public:
 
+	/** GetActionsToLoad - Appends the set actions the build can use, actions of devices compiled out of the build are skipped. */
+	void GetActionsToLoad(TArray<FSoftObjectPath>& OutPaths) const;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
+	TSoftObjectPtr<UInputAction> MoveAction;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
+	TSoftObjectPtr<UInputAction> SpinAction;
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
-	TObjectPtr<UInputAction> MoveAction;
+	TSoftObjectPtr<UInputAction> ZoomAction;
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
-	TObjectPtr<UInputAction> SpinAction;
+	TSoftObjectPtr<UInputAction> SelectAction;
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
-	TObjectPtr<UInputAction> ZoomAction;
+	TSoftObjectPtr<UInputAction> DragMoveAction;
 
+	/** Right stick (Axis2D) driving the gamepad virtual cursor, optional. Not loaded when TOPDOWN_WITH_GAMEPAD is 0 */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
-	TObjectPtr<UInputAction> SelectAction;
+	TSoftObjectPtr<UInputAction> CursorAction;
 
+	/** Orders the selected units to move to the pointer location, optional */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
-	TObjectPtr<UInputAction> DragMoveAction;
+	TSoftObjectPtr<UInputAction> CommandAction;
 };
@@ -0,0 +1,74 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TopDownCommandSubsystem.generated.h"
+
+USTRUCT(BlueprintType)
+struct TOPDOWNMOVEMENT_API FTopDownMoveCommand
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Command")
+	TObjectPtr<AActor> Unit = nullptr;
+
+	/** Formation slot assigned to the unit */
+	UPROPERTY(BlueprintReadOnly, Category = "Command")
+	FVector Destination = FVector::ZeroVector;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnMoveCommandsIssuedSignature, const TArray<FTopDownMoveCommand>&, Commands);
+
+/**
+ * Issues click-to-move orders for a group of units.
+ *
+ * Formation slots are laid out in a grid around the destination, facing away from the group, and each unit
+ * is assigned one slot so the total travel distance stays low. The orders of a group are dispatched
+ * in a single OnMoveCommandsIssued broadcast, the project decides how units actually move there.
+ */
+UCLASS()
+class TOPDOWNMOVEMENT_API UTopDownCommandSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UTopDownCommandSubsystem();
+
+	UPROPERTY(BlueprintAssignable, Category = "Command")
+	FOnMoveCommandsIssuedSignature OnMoveCommandsIssued;
+
+	/** Assigns a formation slot around Destination to every unit and broadcasts the resulting batch. Null units are skipped. */
+	UFUNCTION(BlueprintCallable, Category = "Command")
+	void IssueMoveCommand(const TArray<AActor*>& Units, const FVector& Destination);
+
+	/** Writes NumSlots grid formation slots centered on Destination, with the rows facing along Facing. */
+	UFUNCTION(BlueprintCallable, Category = "Command")
+	void GenerateFormationSlots(int32 NumSlots, const FVector& Destination, const FVector& Facing, TArray<FVector>& OutSlots) const;
+
+	/**
+	 * Assigns one slot per location, OutSlotIndices[i] being the slot of UnitLocations[i].
+	 * Requires at least as many slots as locations.
+	 *
+	 * The CandidateSlots nearest slots of every unit are found in parallel, then all unit-slot pairs are
+	 * taken greedily from the shortest. Units left without a free candidate repeat both steps against the slots still free.
+	 * With one slot per unit, pairing units and slots by their rank in formation order is kept instead when it travels less,
+	 * and a few passes of slot swaps between formation neighbours shorten the travel further.
+	 */
+	static void AssignFormationSlots(TConstArrayView<FVector> UnitLocations, TConstArrayView<FVector> Slots, int32 CandidateSlots, TArray<int32>& OutSlotIndices);
+
+	/** Distance between two neighbouring formation slots. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Command", meta = (ClampMin = "1.0"))
+	float FormationSpacing;
+
+	/** Number of nearest slots considered per unit by the greedy assignment. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Command", meta = (ClampMin = "1"))
+	int32 CandidateSlots;
+
+private:
+	TArray<AActor*> ScratchUnits;
+	TArray<FVector> ScratchUnitLocations;
+	TArray<FVector> ScratchSlots;
+	TArray<int32> ScratchSlotIndices;
+};
@@ -0,0 +1,48 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TopDownGroundFootprint.generated.h"
+
+/**
+ * Ground area visible to the top-down camera, built by deprojecting the four viewport corners
+ * onto the ground plane. Corners are ordered top-left, top-right, bottom-right, bottom-left in screen space.
+ */
+USTRUCT(BlueprintType)
+struct TOPDOWNMOVEMENT_API FTopDownGroundFootprint
+{
+	GENERATED_BODY()
+
+	/** Static arrays cannot be exposed to Blueprint, use ATopDownPlayer::GetGroundFootprintCorners instead */
+	UPROPERTY()
+	FVector Corners[4] = { FVector::ZeroVector, FVector::ZeroVector, FVector::ZeroVector, FVector::ZeroVector };
+
+	/** Centroid of the four corners */
+	UPROPERTY(BlueprintReadOnly, Category = "Footprint")
+	FVector Center = FVector::ZeroVector;
+
+	/** 2D bounds of the quad, used to early out of the containment tests */
+	UPROPERTY(BlueprintReadOnly, Category = "Footprint")
+	FBox2D Bounds = FBox2D(ForceInit);
+
+	UPROPERTY(BlueprintReadOnly, Category = "Footprint")
+	bool bIsValid = false;
+
+	/** Rebuilds Center and Bounds from the corners. */
+	void Finalize();
+
+	/** @return the distance from the center to the furthest corner. */
+	float GetRadius() const;
+
+	/** @return true if the point (XY only) lies inside the quad. */
+	bool ContainsPoint(const FVector2D& Point) const;
+
+	/** @return true if the axis aligned box (XY only) overlaps the quad. */
+	bool IntersectsBox(const FBox2D& Box) const;
+
+	/** @return true if the axis aligned box (XY only) lies entirely inside the quad. */
+	bool ContainsBox(const FBox2D& Box) const;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnGroundFootprintChangedSignature, const FTopDownGroundFootprint&, GroundFootprint);
@@ -0,0 +1,70 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+/**
+ * Centroid and bounding box of a group of actors on the ground plane, maintained from move notifications.
+ *
+ * The centroid is a running sum. The bounds come from per column and per row member counts over a grid of
+ * BinSize, kept sorted by bin so the extremes are the first and last entries. A moved member costs a binary search,
+ * O(log bins), plus an O(bins) array shift only when it enters an empty bin or leaves a bin empty, never O(group size).
+ * Occupied bins are bounded by the group size and the group extent, and the bounds are conservative by up to one bin.
+ */
+struct TOPDOWNMOVEMENT_API FTopDownGroupTracker
+{
+	explicit FTopDownGroupTracker(float InBinSize = 200.0f);
+
+	void Add(const AActor* Actor, const FVector& Location);
+	void Remove(const AActor* Actor);
+
+	/** Ignored for actors that are not in the group. */
+	void Move(const AActor* Actor, const FVector& NewLocation);
+
+	void Reset();
+
+	bool Contains(const AActor* Actor) const { return Members.Contains(Actor); }
+	int32 Num() const { return Members.Num(); }
+	bool IsEmpty() const { return Members.Num() == 0; }
+
+	FVector2D GetCentroid() const;
+
+	/** Bounds of the bins holding members, invalid when empty. */
+	FBox2D GetBounds() const;
+
+private:
+	/** Occupied bins along one axis with their member counts, sorted by bin like a TSortedMap with access to both ends */
+	struct FAxisCounts
+	{
+		struct FBinCount
+		{
+			int32 Bin;
+			int32 Count;
+		};
+
+		TArray<FBinCount> Bins;
+
+		void Add(int32 Bin);
+		void Remove(int32 Bin);
+		void Reset() { Bins.Reset(); }
+
+		int32 GetMin() const { return Bins[0].Bin; }
+		int32 GetMax() const { return Bins.Last().Bin; }
+	};
+
+	FIntPoint GetBin(const FVector2D& Location) const;
+
+	float BinSize;
+	float InvBinSize;
+
+	TMap<TObjectKey<AActor>, FVector2D> Members;
+
+	/** Sum of the member locations, in double precision so long sessions do not drift */
+	double SumX;
+	double SumY;
+
+	FAxisCounts Columns;
+	FAxisCounts Rows;
+};
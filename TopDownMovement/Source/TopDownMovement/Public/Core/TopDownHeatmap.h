@@ -0,0 +1,87 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Per cell counters stored by FTopDownHeatmap */
+enum class ETopDownHeatmapLayer : uint8
+{
+	/** Samples of the camera interaction point (TargetHandle) */
+	TargetHandle,
+	/** Samples where the cursor was over a selectable */
+	Hover,
+	/** Number of samples with a zoom value, pairs with ZoomSum */
+	ZoomSamples,
+	/** Sum of the zoom values quantized to 0-255, ZoomSum / ZoomSamples is the average zoom of the cell */
+	ZoomSum,
+
+	Num
+};
+
+/**
+ * Fixed resolution 2D grid of integer counters over the ground plane.
+ * All storage is allocated in Init, recording only increments counters. Locations outside Bounds are dropped.
+ *
+ * File layout (little endian): magic, version, resolution X/Y, bounds min/max, layer count, then one uint32 per cell and layer.
+ */
+struct TOPDOWNMOVEMENT_API FTopDownHeatmap
+{
+	static constexpr uint32 FileMagic = 0x4D485444; // "TDHM"
+	static constexpr uint32 FileVersion = 1;
+
+	FTopDownHeatmap();
+
+	void Init(const FBox2D& InBounds, const FIntPoint& InResolution);
+
+	bool IsInitialized() const { return Counters.Num() > 0; }
+
+	void RecordTargetHandle(const FVector& Location) { Increment(ETopDownHeatmapLayer::TargetHandle, Location, 1); }
+	void RecordHover(const FVector& Location) { Increment(ETopDownHeatmapLayer::Hover, Location, 1); }
+	void RecordZoom(const FVector& Location, float ZoomValue);
+
+	uint32 GetCounter(ETopDownHeatmapLayer Layer, const FIntPoint& Cell) const;
+
+	/** @return the average zoom (0-1) recorded in the cell, or -1 if no zoom was recorded there. */
+	float GetAverageZoom(const FIntPoint& Cell) const;
+
+	/** @return the cell of the location, or (-1, -1) outside Bounds. */
+	FIntPoint GetCell(const FVector& Location) const;
+
+	const FBox2D& GetBounds() const { return Bounds; }
+	const FIntPoint& GetResolution() const { return Resolution; }
+
+	/** Copies the counters of Other without reallocating when the resolution matches. */
+	void CopyFrom(const FTopDownHeatmap& Other);
+
+	/** Adds the counters of Other, both heatmaps need the same bounds and resolution. */
+	bool Merge(const FTopDownHeatmap& Other);
+
+	void Reset();
+
+	/** Writes Filename.tmp and moves it over Filename, the previous file stays intact if the write fails. */
+	bool SaveToFile(const FString& Filename) const;
+	bool LoadFromFile(const FString& Filename);
+
+	/**
+	 * Loads every heatmap file in Filenames and merges them into OutHeatmap, skipping files that
+	 * do not match the layout of the first one.
+	 * @return the number of merged files.
+	 */
+	static int32 LoadAndMerge(const TArray<FString>& Filenames, FTopDownHeatmap& OutHeatmap);
+
+private:
+	void Increment(ETopDownHeatmapLayer Layer, const FVector& Location, uint32 Amount);
+
+	int32 GetCounterIndex(ETopDownHeatmapLayer Layer, const FIntPoint& Cell) const
+	{
+		return (static_cast<int32>(Layer) * Resolution.Y + Cell.Y) * Resolution.X + Cell.X;
+	}
+
+	FBox2D Bounds;
+	FIntPoint Resolution;
+	FVector2D InvCellSize;
+
+	/** Layer-major counters, one block of Resolution.X * Resolution.Y per layer */
+	TArray<uint32> Counters;
+};
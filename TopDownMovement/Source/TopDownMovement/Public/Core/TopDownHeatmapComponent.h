@@ -0,0 +1,83 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Core/TopDownHeatmap.h"
+#include "Tasks/Task.h"
+#include "TopDownHeatmapComponent.generated.h"
+
+class ATopDownPlayer;
+class APawn;
+class AController;
+
+/**
+ * Optional camera telemetry recorder, add it to an ATopDownPlayer to collect where players look, hover and zoom.
+ *
+ * The owner is sampled every SampleInterval seconds into an FTopDownHeatmap, a copy of it is written to
+ * Saved/<OutputDirectory>/<session>.tdheat on a background task every FlushInterval seconds and at EndPlay.
+ * Recording follows possession, it starts once the owner becomes locally controlled and pauses while it is not.
+ * Sessions are merged offline with FTopDownHeatmap::LoadAndMerge or the TopDown.MergeHeatmaps console command.
+ */
+UCLASS(ClassGroup = (TopDown), meta = (BlueprintSpawnableComponent))
+class TOPDOWNMOVEMENT_API UTopDownHeatmapComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UTopDownHeatmapComponent();
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	/** Area of the level covered by the heatmap, samples outside of it are dropped. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Telemetry")
+	FBox2D HeatmapBounds;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Telemetry", meta = (ClampMin = "1", ClampMax = "4096"))
+	FIntPoint HeatmapResolution;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Telemetry", meta = (ClampMin = "0.01"))
+	float SampleInterval;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Telemetry", meta = (ClampMin = "1.0"))
+	float FlushInterval;
+
+	/** Relative to the project Saved directory. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Telemetry")
+	FString OutputDirectory;
+
+	/** Writes the current counters to the session file on a background task, skipped while a previous flush is still running. */
+	UFUNCTION(BlueprintCallable, Category = "Telemetry")
+	void Flush();
+
+	UFUNCTION(BlueprintPure, Category = "Telemetry")
+	FString GetSessionFilename() const { return SessionFilename; }
+
+	const FTopDownHeatmap& GetHeatmap() const { return Heatmap; }
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+	void Sample();
+
+	/** Starts or pauses sampling, called on BeginPlay and whenever the owning pawn changes controller. */
+	void UpdateRecording();
+
+	UFUNCTION()
+	void OnOwnerControllerChanged(APawn* Pawn, AController* OldController, AController* NewController);
+
+	UPROPERTY(Transient)
+	TObjectPtr<ATopDownPlayer> Player;
+
+	FTopDownHeatmap Heatmap;
+
+	/** Copy handed to the flush task, reused between flushes */
+	TSharedPtr<FTopDownHeatmap, ESPMode::ThreadSafe> FlushSnapshot;
+	UE::Tasks::FTask FlushTask;
+
+	FString SessionFilename;
+	float TimeSinceFlush;
+};
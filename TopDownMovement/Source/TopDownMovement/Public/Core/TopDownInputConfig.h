@@ -0,0 +1,18 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+// Input devices compiled into the plugin. A project compiles one out from its Target.cs, e.g. GlobalDefinitions.Add("TOPDOWN_WITH_GAMEPAD=0"),
+// devices the target does not set get the platform default from TopDownMovement.Build.cs (only what the platform can use in Shipping).
+// The defaults below only apply to code built outside of UnrealBuildTool, which sets neither
+#ifndef TOPDOWN_WITH_MOUSE
+#define TOPDOWN_WITH_MOUSE 1
+#endif
+
+#ifndef TOPDOWN_WITH_TOUCH
+#define TOPDOWN_WITH_TOUCH 1
+#endif
+
+#ifndef TOPDOWN_WITH_GAMEPAD
+#define TOPDOWN_WITH_GAMEPAD 1
+#endif
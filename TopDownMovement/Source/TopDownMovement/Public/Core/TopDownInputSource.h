@@ -0,0 +1,167 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "Core/TopDownController.h"
+#include "TopDownInputSource.generated.h"
+
+class ATopDownPlayer;
+class APlayerController;
+
+/**
+ * Pointer and viewport state read by ATopDownPlayer for cursor projection, edge scrolling and touch checks.
+ * The player never queries its controller for these directly, so the camera logic also runs without a viewport
+ * (dedicated server, -nullrhi, bots) when a synthetic source is injected.
+ */
+UCLASS(Abstract, EditInlineNew, DefaultToInstanced, BlueprintType)
+class TOPDOWNMOVEMENT_API UTopDownInputSource : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Called by the player when the source is assigned to it. */
+	virtual void Initialize(ATopDownPlayer* InPlayer) { Player = InPlayer; }
+
+	/** Advances scripted input, called by the player before reading from the source. */
+	virtual void Update(float DeltaSeconds) {}
+
+	/** Device the player should use right away, Unknown waits for the controller to report one. */
+	virtual EInputType GetInitialInputType() const { return EInputType::Unknown; }
+
+	/** Viewport size in pixels, (0, 0) when there is no viewport to project to. */
+	virtual FIntPoint GetViewportSize() const PURE_VIRTUAL(UTopDownInputSource::GetViewportSize, return FIntPoint::ZeroValue;);
+
+	virtual bool GetMousePosition(FVector2D& OutScreenPos) const PURE_VIRTUAL(UTopDownInputSource::GetMousePosition, return false;);
+
+	/** @return true while the touch is pressed, OutScreenPos is only valid then. */
+	virtual bool GetTouchState(ETouchIndex::Type TouchIndex, FVector2D& OutScreenPos) const PURE_VIRTUAL(UTopDownInputSource::GetTouchState, return false;);
+
+	virtual bool DeprojectScreenToWorld(const FVector2D& ScreenPos, FVector& OutWorldOrigin, FVector& OutWorldDirection) const PURE_VIRTUAL(UTopDownInputSource::DeprojectScreenToWorld, return false;);
+
+	/** Synthetic sources drive bots, which publish their camera interest like remote players so load tests cover the relevancy path. */
+	virtual bool IsSynthetic() const { return false; }
+
+	ATopDownPlayer* GetPlayer() const { return Player; }
+
+protected:
+	UPROPERTY(Transient)
+	TObjectPtr<ATopDownPlayer> Player;
+};
+
+/** Default source, forwards to the player controller possessing the pawn. */
+UCLASS(meta = (DisplayName = "Controller Input Source"))
+class TOPDOWNMOVEMENT_API UTopDownControllerInputSource : public UTopDownInputSource
+{
+	GENERATED_BODY()
+
+public:
+	virtual FIntPoint GetViewportSize() const override;
+	virtual bool GetMousePosition(FVector2D& OutScreenPos) const override;
+	virtual bool GetTouchState(ETouchIndex::Type TouchIndex, FVector2D& OutScreenPos) const override;
+	virtual bool DeprojectScreenToWorld(const FVector2D& ScreenPos, FVector& OutWorldOrigin, FVector& OutWorldDirection) const override;
+
+private:
+	/** The controller currently possessing the pawn, never cached so possession changes are followed */
+	APlayerController* GetPlayerController() const;
+};
+
+/** Actions a synthetic source can press, mirroring the bindings of UInputDataSetup. */
+UENUM(BlueprintType)
+enum class ETopDownSimulatedAction : uint8
+{
+	None,
+	/** Selects the selectables under the cursor, drags the camera while held when there are none */
+	Select,
+	/** Orders the selection to the cursor, see ATopDownPlayer::IssueMoveCommand */
+	Command,
+	ZoomIn,
+	ZoomOut
+};
+
+USTRUCT(BlueprintType)
+struct TOPDOWNMOVEMENT_API FTopDownSyntheticInputKey
+{
+	GENERATED_BODY()
+
+	/** Seconds from the start of the script */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input")
+	float Time = 0.0f;
+
+	/** Pointer position in viewport pixels, interpolated from the previous key */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input")
+	FVector2D PointerPosition = FVector2D::ZeroVector;
+
+	/** Touch1 pressed state, held until the next key */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input")
+	bool bTouchPressed = false;
+
+	/** Action pressed when the key is reached and held until the next key */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input")
+	ETopDownSimulatedAction Action = ETopDownSimulatedAction::None;
+};
+
+/**
+ * Source with a virtual viewport, driven either by a looping key script or directly through SetPointerPosition / SetTouchPressed.
+ * Deprojection uses the player camera with the virtual viewport size, so it works without a rendering viewport.
+ * Script actions are pressed on the player through ATopDownPlayer::SimulateAction, as Started / Triggered every update / Completed.
+ */
+UCLASS(meta = (DisplayName = "Synthetic Input Source"))
+class TOPDOWNMOVEMENT_API UTopDownSyntheticInputSource : public UTopDownInputSource
+{
+	GENERATED_BODY()
+
+public:
+	UTopDownSyntheticInputSource();
+
+	virtual void Update(float DeltaSeconds) override;
+	virtual EInputType GetInitialInputType() const override { return InputType; }
+
+	virtual FIntPoint GetViewportSize() const override { return ViewportSize; }
+	virtual bool GetMousePosition(FVector2D& OutScreenPos) const override;
+	virtual bool GetTouchState(ETouchIndex::Type TouchIndex, FVector2D& OutScreenPos) const override;
+	virtual bool DeprojectScreenToWorld(const FVector2D& ScreenPos, FVector& OutWorldOrigin, FVector& OutWorldDirection) const override;
+	virtual bool IsSynthetic() const override { return true; }
+
+	UFUNCTION(BlueprintCallable, Category = "Input")
+	void SetPointerPosition(const FVector2D& NewPointerPosition) { PointerPosition = NewPointerPosition; }
+
+	UFUNCTION(BlueprintCallable, Category = "Input")
+	void SetTouchPressed(bool bNewTouchPressed) { bTouchPressed = bNewTouchPressed; }
+
+	/** Replaces the script and restarts it from the first key. Keys must be sorted by time. */
+	UFUNCTION(BlueprintCallable, Category = "Input")
+	void SetScript(const TArray<FTopDownSyntheticInputKey>& NewScript);
+
+	/**
+	 * MakeRandomScript - Keys wandering the pointer across the viewport, crossing the edge scrolling margins,
+	 * with a select, command or zoom action held on about half of them. The same stream seed gives the same script.
+	 */
+	static void MakeRandomScript(FRandomStream& RandomStream, const FIntPoint& ScriptViewportSize, int32 NumKeys, TArray<FTopDownSyntheticInputKey>& OutScript);
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input")
+	EInputType InputType;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input")
+	FIntPoint ViewportSize;
+
+	/** Played by Update when not empty, keys must be sorted by time. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
+	TArray<FTopDownSyntheticInputKey> Script;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input")
+	bool bLoopScript;
+
+private:
+	/** Completes the held action when the script reached another key, and presses the action of that key. */
+	void UpdateHeldAction(bool bNewKey);
+
+	FVector2D PointerPosition;
+	bool bTouchPressed;
+
+	float ScriptTime;
+	int32 ScriptKeyIndex;
+
+	ETopDownSimulatedAction HeldAction;
+};
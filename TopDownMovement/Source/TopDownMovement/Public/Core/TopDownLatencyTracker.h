@@ -0,0 +1,33 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Records the time between an input sample and the moment it changed the camera transform.
+ * Latencies are kept in a fixed size ring buffer so recording never allocates after construction.
+ */
+struct TOPDOWNMOVEMENT_API FTopDownLatencyTracker
+{
+	explicit FTopDownLatencyTracker(int32 InCapacity = 1024);
+
+	/** Timestamps an input sample. Only the oldest sample not yet applied is kept, so latency is measured from it. */
+	void MarkInputSample();
+
+	/** Records the latency of the pending input sample, if any. */
+	void MarkCameraApplied();
+
+	/** Computes the 50th and 99th percentile latencies in milliseconds, both are 0 when nothing was recorded. */
+	void GetPercentiles(float& OutP50Ms, float& OutP99Ms) const;
+
+	int32 GetNumSamples() const { return NumSamples; }
+
+	void Reset();
+
+private:
+	TArray<float> LatenciesMs;
+	int32 NextIndex;
+	int32 NumSamples;
+	double PendingSampleTime;
+};
@@ -0,0 +1,163 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "WorldCollision.h"
+#include "TopDownOcclusionComponent.generated.h"
+
+class UPrimitiveComponent;
+class UMaterialInterface;
+class UMaterialInstanceDynamic;
+class UCameraComponent;
+class APawn;
+class AController;
+
+USTRUCT()
+struct FTopDownOcclusionFade
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TWeakObjectPtr<UPrimitiveComponent> Component;
+
+	/** Materials to restore once the component is fully visible again */
+	UPROPERTY()
+	TArray<TObjectPtr<UMaterialInterface>> OriginalMaterials;
+
+	UPROPERTY()
+	TArray<TObjectPtr<UMaterialInstanceDynamic>> FadeInstances;
+
+	float Opacity = 1.0f;
+	float TargetOpacity = 1.0f;
+};
+
+USTRUCT()
+struct FTopDownMaterialInstancePool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<UMaterialInstanceDynamic>> Instances;
+};
+
+/**
+ * Fades out geometry between the top-down camera and its focus (the owner location) and the selected units.
+ *
+ * Sweeps are issued as one asynchronous batch every OcclusionCheckInterval seconds instead of every frame.
+ * Occluders are cached between batches and only components that start or stop occluding are touched.
+ * Fading swaps the component materials for dynamic instances taken from a pool, their parent material
+ * has to expose the FadeParameterName scalar (e.g. driving a dithered opacity mask).
+ *
+ * When the owner is a pawn, sweeps only run while it is controlled by a local player, and start or stop as its controller changes.
+ */
+UCLASS(ClassGroup = (TopDown), meta = (BlueprintSpawnableComponent))
+class TOPDOWNMOVEMENT_API UTopDownOcclusionComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UTopDownOcclusionComponent();
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Occlusion")
+	bool bEnableOcclusionFade;
+
+	/** Seconds between two sweep batches, change it at runtime through SetOcclusionCheckInterval. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Occlusion", meta = (ClampMin = "0.01"))
+	float OcclusionCheckInterval;
+
+	/**
+	 * Geometry blocking or overlapping this channel is faded. The sweep treats blocking hits as overlaps,
+	 * so it does not stop at the first occluder.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Occlusion")
+	TEnumAsByte<ECollisionChannel> OcclusionTraceChannel;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Occlusion", meta = (ClampMin = "0.0"))
+	float OcclusionSweepRadius;
+
+	/**
+	 * Height above the focus and the selected units the sweeps aim at. Sweeps stop OcclusionSweepRadius short of it,
+	 * and components whose bounds top is below the end of the sweep are treated as floor and never faded.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Occlusion", meta = (ClampMin = "0.0"))
+	float OcclusionTargetHeight;
+
+	/** Maximum number of selected units swept per batch, in addition to the camera focus. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Occlusion", meta = (ClampMin = "0"))
+	int32 MaxSelectedTargets;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Occlusion", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float FadedOpacity;
+
+	/** Opacity change per second. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Occlusion", meta = (ClampMin = "0.0"))
+	float FadeSpeed;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Occlusion")
+	FName FadeParameterName;
+
+	/** SetOcclusionCheckInterval - Changes the seconds between two sweep batches, re-arming the running timer with the new interval. */
+	UFUNCTION(BlueprintCallable, Category = "Occlusion")
+	void SetOcclusionCheckInterval(float NewInterval);
+
+	/** CheckOcclusionNow - Issues a sweep batch right away instead of waiting for the timer, e.g. after a camera cut. */
+	UFUNCTION(BlueprintCallable, Category = "Occlusion")
+	void CheckOcclusionNow();
+
+	/** Components currently faded or fading back in. */
+	UFUNCTION(BlueprintPure, Category = "Occlusion")
+	int32 GetNumFadedComponents() const { return ActiveFades.Num(); }
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+	/** Proxies, bots and dedicated servers have no view to fade geometry for. */
+	bool ShouldCheckOcclusion() const;
+
+	/** Starts or stops the sweep timer, called on BeginPlay and whenever the owning pawn changes controller. */
+	void UpdateOcclusionTimer();
+
+	UFUNCTION()
+	void OnOwnerControllerChanged(APawn* Pawn, AController* OldController, AController* NewController);
+
+	/** Drops the batch in flight and restores the original materials of every faded component. */
+	void ResetOcclusion();
+
+	/** Issues the sweep batch from the camera to the focus and the selected units. */
+	void StartOcclusionBatch();
+
+	void OnOcclusionTraceCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+
+	/** Compares the occluders found by the finished batch with the cached ones and updates the fade targets. */
+	void FinishOcclusionBatch();
+
+	void BeginFade(UPrimitiveComponent* Component);
+	void EndFade(FTopDownOcclusionFade& Fade);
+
+	UMaterialInstanceDynamic* AcquireInstance(UMaterialInterface* ParentMaterial);
+	void ReleaseInstance(UMaterialInstanceDynamic* Instance);
+
+	UPROPERTY(Transient)
+	TArray<FTopDownOcclusionFade> ActiveFades;
+
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UMaterialInterface>, FTopDownMaterialInstancePool> InstancePools;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UCameraComponent> Camera;
+
+	/** Occluders reported by the batch in flight */
+	TSet<TWeakObjectPtr<UPrimitiveComponent>> BatchOccluders;
+
+	FTraceDelegate TraceDelegate;
+	int32 PendingTraces;
+	uint32 BatchId;
+
+	FTimerHandle OcclusionTimerHandle;
+};
@@ -5,6 +5,14 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Pawn.h"
 #include "InputActionValue.h"
+#include "InputTriggers.h"
+#include "Core/TopDownInputSource.h"
+#include "Core/TopDownGroundFootprint.h"
+#include "Core/TopDownLatencyTracker.h"
+#include "Core/TopDownViewProjection.h"
+#include "Core/TopDownGroupTracker.h"
+#include "Core/TopDownRelevancySubsystem.h"
+#include "WorldPartition/WorldPartitionStreamingSource.h"
 #include "TopDownPlayer.generated.h"
 
 class USphereComponent;
@@ -15,9 +23,37 @@ class UFloatingPawnMovement;
 class UInputMappingContext;
 class UInputDataSetup;
 class UInputAction;
+class UTopDownSignificanceSubsystem;
+class UTopDownOcclusionComponent;
+class UTopDownSelectionSubsystem;
+class UEnhancedInputComponent;
+struct FStreamableHandle;
+class ATopDownPlayer;
+
+/** Runs ATopDownPlayer::PostMovementTick once the pawn, its movement component and the spring arm have placed the camera for the frame. */
+USTRUCT()
+struct FTopDownPostMovementTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	ATopDownPlayer* Target = nullptr;
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRefPtr& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+	virtual FName DiagnosticContext(bool bDetailed) override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FTopDownPostMovementTickFunction> : public TStructOpsTypeTraitsBase2<FTopDownPostMovementTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
 
 UCLASS()
-class TOPDOWNMOVEMENT_API ATopDownPlayer : public APawn
+class TOPDOWNMOVEMENT_API ATopDownPlayer : public APawn, public IWorldPartitionStreamingSourceProvider
 {
 	GENERATED_BODY()
 
@@ -26,8 +62,167 @@ public:
 
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 
+	/** Moves the mapping contexts and the input type binding to the new controller, and streams the input assets once a local player possesses the pawn. */
+	virtual void NotifyControllerChanged() override;
+
+	/**
+	 * Applies pending drag input and runs MoveTracking, ticks in TG_PostPhysics after the controller processed input.
+	 * The input path only runs on the locally controlled pawn.
+	 */
+	virtual void Tick(float DeltaSeconds) override;
+
+	/**
+	 * PostMovementTick - Recomputes the ground footprint from the camera's final view of the frame and publishes it as the
+	 * significance focus and the camera interest. Runs from PostMovementTickFunction, after the movement component and the spring arm.
+	 */
+	void PostMovementTick(float DeltaSeconds);
+
+	/**
+	 * GetInputLatencyPercentiles - Time between an input sample (drag, move, start of an edge scroll) and the camera transform change it caused.
+	 * Origin pull, group follow, spin and server corrections never complete a sample. Only recorded while bRecordInputLatency is enabled.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Debug")
+	void GetInputLatencyPercentiles(float& P50Ms, float& P99Ms) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Debug")
+	void ResetInputLatency();
+
+	/**
+	 * GetViewProjection - View-projection of the camera, re-captured on use whenever the camera view or viewport changed.
+	 * Use it with FTopDownWorldPoints / FTopDownScreenPoints, relative to GetViewOrigin, to project thousands of positions in one batch.
+	 */
+	const FTopDownViewProjection& GetViewProjection();
+
+	/**
+	 * ProjectWorldLocationsToScreen - Blueprint friendly batch projection through GetViewProjection.
+	 * @param OutVisible: True when the location is in front of the camera and inside the viewport.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Camera")
+	void ProjectWorldLocationsToScreen(const TArray<FVector>& Locations, TArray<FVector2D>& OutScreenPositions, TArray<bool>& OutVisible);
+
+	/**
+	 * FindNearestLocationToCursor - Index of the location closest to the cursor in screen space.
+	 * @param MaxScreenDistance: Search radius in viewport pixels.
+	 * @return INDEX_NONE when no visible location is within MaxScreenDistance.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Camera")
+	int32 FindNearestLocationToCursor(const TArray<FVector>& Locations, float MaxScreenDistance);
+
+	/** IWorldPartitionStreamingSourceProvider implementation */
+	virtual const UObject* GetStreamingSourceOwner() const override { return this; }
+	virtual bool GetStreamingSources(TArray<FWorldPartitionStreamingSource>& OutStreamingSources) const override;
+
+	/** Smoothed velocity of the ground footprint center the streaming source is extrapolated from. */
+	FVector GetStreamingViewVelocity() const { return StreamingViewVelocity; }
+
+	/**
+	 * GetGroundFootprintRadius - Radius of the ground area visible to the camera at the current zoom.
+	 * Uses the cached ground footprint when available, otherwise estimates it from the SpringArm length, pitch and the camera FOV.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Camera")
+	float GetGroundFootprintRadius() const;
+
+	/** Visible ground quad, refreshed only when the camera transform, FOV or viewport changes. */
+	const FTopDownGroundFootprint& GetGroundFootprint() const { return GroundFootprint; }
+
+	UFUNCTION(BlueprintPure, Category = "Camera", meta = (DisplayName = "Get Ground Footprint"))
+	FTopDownGroundFootprint K2_GetGroundFootprint() const { return GroundFootprint; }
+
+	UFUNCTION(BlueprintPure, Category = "Camera")
+	TArray<FVector> GetGroundFootprintCorners() const;
+
+	/** @return true if the location (XY only) is inside the visible ground area. */
+	UFUNCTION(BlueprintPure, Category = "Camera")
+	bool IsInGroundFootprint(const FVector& Location) const { return GroundFootprint.ContainsPoint(FVector2D(Location)); }
+
+	/** @return true if the box (XY only) overlaps the visible ground area. */
+	UFUNCTION(BlueprintPure, Category = "Camera")
+	bool OverlapsGroundFootprint(const FBox& Box) const { return GroundFootprint.IntersectsBox(FBox2D(FVector2D(Box.Min), FVector2D(Box.Max))); }
+
+	/** Screen position of the gamepad virtual cursor in viewport pixels, negative until the gamepad is first used. */
+	UFUNCTION(BlueprintPure, Category = "Gamepad")
+	FVector2D GetVirtualCursorPosition() const { return VirtualCursorPosition; }
+
+	/** Selectable the virtual cursor is currently snapped to, if any. */
+	UFUNCTION(BlueprintPure, Category = "Gamepad")
+	AActor* GetVirtualCursorSnapTarget() const { return VirtualCursorSnapTarget.Get(); }
+
+	/** Last ground point grabbed under the pointer by PositionCheck. */
+	UFUNCTION(BlueprintPure, Category = "Camera")
+	FVector GetTargetHandle() const { return TargetHandle; }
+
+	/** Normalized zoom, 0 is fully zoomed in and 1 fully zoomed out. */
+	UFUNCTION(BlueprintPure, Category = "Camera")
+	float GetZoomValue() const { return ZoomValue; }
+
+	/** Ground location of the cursor (CollisionSphere). */
+	UFUNCTION(BlueprintPure, Category = "Camera")
+	FVector GetCursorLocation() const;
+
+	/** @return true while the cursor overlaps an actor. */
+	UFUNCTION(BlueprintPure, Category = "Camera")
+	bool IsHoveringSelectable() const;
+
+	/**
+	 * StartGroupFollow - Keeps the camera centered on the units and adjusts the zoom so the whole group stays inside the ground footprint.
+	 * Only selectables (UTopDownSelectableComponent) are tracked, incrementally from their move notifications.
+	 * Move, drag and zoom input stop the follow.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Camera")
+	void StartGroupFollow(const TArray<AActor*>& Units);
+
+	/** Starts a group follow on the current selection of UTopDownSelectionSubsystem. */
+	UFUNCTION(BlueprintCallable, Category = "Camera")
+	void FollowSelection();
+
+	UFUNCTION(BlueprintCallable, Category = "Camera")
+	void StopGroupFollow();
+
+	UFUNCTION(BlueprintPure, Category = "Camera")
+	bool IsFollowingGroup() const { return bFollowingGroup; }
+
+	/**
+	 * SetInputSource - Replaces the source the pointer and viewport are read from, e.g. a UTopDownSyntheticInputSource for bots.
+	 * Switches to the source's initial input type when it has one.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Input")
+	void SetInputSource(UTopDownInputSource* NewInputSource);
+
+	UFUNCTION(BlueprintPure, Category = "Input")
+	UTopDownInputSource* GetInputSource() const { return InputSource; }
+
+	/**
+	 * SimulateAction - Presses a bound action without an input component, used by UTopDownSyntheticInputSource.
+	 * Select selects the selectables around the cursor, or drags the camera while Triggered when there are none.
+	 * Command is issued on Started, zoom is applied on every Triggered.
+	 */
+	void SimulateAction(ETopDownSimulatedAction Action, ETriggerEvent TriggerEvent);
+
+	/** True once the soft referenced input assets are streamed in and the input actions are bound, only ever true on a locally controlled pawn. */
+	UFUNCTION(BlueprintPure, Category = "Input")
+	bool AreInputAssetsLoaded() const { return bInputAssetsLoaded; }
+
+	/** Input data, mapping contexts and curves streamed for a local player, without the devices compiled out of the build. */
+	void GetInputAssetPaths(TArray<FSoftObjectPath>& OutAssetPaths) const;
+
+	/**
+	 * FindSnapTarget - Nearest selectable to the screen position within VirtualCursorSnapRadius pixels.
+	 * Uses the selection subsystem grid, converting the screen radius to a ground radius around the cursor,
+	 * and stops once VirtualCursorSnapBudgetMs is spent, returning the nearest found so far and setting bOutBudgetExhausted.
+	 */
+	AActor* FindSnapTarget(const FVector2D& ScreenPos, FVector2D& OutTargetScreenPos, bool* bOutBudgetExhausted = nullptr);
+
+	float GetVirtualCursorSnapRadius() const { return VirtualCursorSnapRadius; }
+	float GetVirtualCursorSnapBudgetMs() const { return VirtualCursorSnapBudgetMs; }
+
+	/** Broadcast whenever the visible ground area is recomputed. */
+	UPROPERTY(BlueprintAssignable, Category = "Camera")
+	FOnGroundFootprintChangedSignature OnGroundFootprintChanged;
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void RegisterActorTickFunctions(bool bRegister) override;
 
 	/**
 	* Called when another actor begins to overlap with this actor.
@@ -45,6 +240,10 @@ protected:
 	UFUNCTION()
 	void OverlapEnd(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
 
+	/**
+	 * HandleInputTypeSwitched - Stores the new input type and selects the update routines specialized for that device.
+	 * Devices compiled out with TOPDOWN_WITH_MOUSE / TOPDOWN_WITH_TOUCH / TOPDOWN_WITH_GAMEPAD fall back to no input.
+	 */
 	UFUNCTION()
 	void HandleInputTypeSwitched(EInputType NewInputType);
 
@@ -57,9 +256,20 @@ protected:
 	UFUNCTION()
 	void Zoom(const FInputActionValue& Value);
 
+	/** Queues the drag, it is applied by ApplyDragMove in Tick. */
 	UFUNCTION()
 	void DragMove();
 
+	/** Moves the pawn so the ground point grabbed in PositionCheck (TargetHandle) stays under the pointer. */
+	UFUNCTION()
+	void ApplyDragMove();
+
+	void OnRootTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	/** Stores the right stick value, the virtual cursor is moved in MoveTracking. */
+	UFUNCTION()
+	void CursorMove(const FInputActionValue& Value);
+
 	UFUNCTION()
 	void SelectStarted();
 
@@ -73,10 +283,18 @@ protected:
 	void HandleSelection();
 
 	/**
-	 * MoveTracking - Continuously updates player pawn movement.
+	* IssueMoveCommand - Orders the current selection (UTopDownSelectionSubsystem) to move in formation to the ground point under the pointer.
+	* The orders are dispatched in one batch by UTopDownCommandSubsystem::OnMoveCommandsIssued.
+	*/
+	UFUNCTION(BlueprintCallable)
+	void IssueMoveCommand();
+
+	/**
+	 * MoveTracking - Continuously updates player pawn movement, called every Tick.
 	 * 1. Pulls pawn toward the world origin if it moves beyond a set distance (PullStartDistance).
 	 * 2. Manages edge scrolling: moves the pawn when the cursor or touch is near viewport edges.
 	 * 3. Updates the cursor position on-screen and aligns the collision detection sphere.
+	 * The footprint and the camera focus follow in PostMovementTick, once the camera has moved.
 	 */
 	UFUNCTION()
 	void MoveTracking();
@@ -90,6 +308,14 @@ protected:
 	UFUNCTION()
 	void UpdateZoom();
 
+	/** ServerUpdateCameraInterest - Stores the camera interest of the owning client in UTopDownRelevancySubsystem. */
+	UFUNCTION(Server, Unreliable)
+	void ServerUpdateCameraInterest(const FTopDownCameraInterest& Interest);
+
+	/** ApplyZoom - Applies the current ZoomValue to the arm length, camera angle, movement speed, depth of field and FOV. */
+	UFUNCTION()
+	void ApplyZoom();
+
 	/**
 	 * UpdateCursorPosition - Updates the cursor plane's location and scale based on the current input type (touch vs. hover).
 	 * - For touch input, attempts to project the screen touch location onto the ground plane.
@@ -109,6 +335,26 @@ protected:
 	UFUNCTION()
 	void PositionCheck();
 
+	/**
+	 * UpdateVirtualCursor - Moves the gamepad virtual cursor from the right stick and applies aim assist.
+	 * Speed follows VirtualCursorAccelerationCurve (stick deflection) and ramps up while the stick is held.
+	 * When the stick is released near a selectable, the cursor is pulled onto it.
+	 */
+	void UpdateVirtualCursor(float DeltaSeconds);
+
+	/** Deprojects a screen position onto the ground plane used by ProjectToGroundPlane. */
+	bool DeprojectScreenToGround(const FVector2D& ScreenPos, FVector& OutGroundLocation) const;
+
+	/** Intersection of the ray with the ground plane used by ProjectToGroundPlane, clamped to the end of the ray above the horizon. */
+	static FVector IntersectGroundPlane(const FVector& WorldOrigin, const FVector& WorldDirection);
+
+	/**
+	 * UpdateGroundFootprint - Deprojects the four viewport corners onto the same ground plane used by ProjectToGroundPlane.
+	 * Uses the camera component's current view, and is skipped when that view and the viewport size are unchanged since the last update.
+	 */
+	UFUNCTION()
+	void UpdateGroundFootprint();
+
 	/**
 	 * DepthOfField - Configures depth of field settings on the player's camera using post-process overrides.
 	 * Uses the SpringArm's length as the focal distance to dynamically adjust focus based on camera distance.
@@ -118,7 +364,7 @@ protected:
 
 	/**
 	 * ProjectToGroundPlane - Converts 2D cursor/touch positions into 3D game-world intersections.
-	 * @param LocalPlayerController: The player's controller used for viewport and input calculations.
+	 * @param LocalPlayerController: Unused, the pointer and viewport are read from InputSource.
 	 * @param OutScreenPos: Returns the 2D viewport position of the input.
 	 * @param OutIntersection: Returns the intersection position on the ground plane.
 	 * @return bool - Indicates successful projection based on input validity.
@@ -129,7 +375,7 @@ protected:
 	/**
 	 * CursorDistFromCenter - Computes how far the cursor is from the center of the viewport.
 	 *
-	 * @param LocalPlayerController: The player's controller used for viewport and input calculations.
+	 * @param LocalPlayerController: Unused, the pointer and viewport are read from InputSource.
 	 * @param CursorPos: Current cursor position.
 	 * @param Direction: Output direction vector relative to viewport center.
 	 * @param Strength: Output strength scalar indicating how far from the center the cursor is.
@@ -141,7 +387,7 @@ protected:
 	 * EdgeMove - Calculates movement direction and strength based on the cursors offset from the screen center.
 	 * Converts the local direction to world space relative to the player's transform.
 	 *
-	 * @param LocalPlayerController: The player's controller used for viewport and input calculations.
+	 * @param LocalPlayerController: Unused, the pointer and viewport are read from InputSource.
 	 * @param Direction: Output world-space direction vector.
 	 * @param Strength: Output movement strength scalar.
 	 */
@@ -149,10 +395,10 @@ protected:
 	inline void EdgeMove(APlayerController* LocalPlayerController, FVector& Direction, float& Strenght);
 
 	/**
-	 * SingleTouchCheck - Checks if a second touch input (Touch2) is currently not pressed on the given player controller.
+	 * SingleTouchCheck - Checks if a second touch input (Touch2) is currently not pressed.
 	 * Returns true if the second touch is not pressed, and false if it is pressed.
 	 *
-	 * @param LocalPlayerController: The player's controller handling the touch inputs.
+	 * @param LocalPlayerController: Unused, the touch state is read from InputSource.
 	 * @return bool indicating the presence of a single touch input.
 	 */
 	UFUNCTION()
@@ -168,7 +414,29 @@ protected:
 	* @return true if overlapping interactable actors are detected; false otherwise.
 	*/
 	UFUNCTION()
-	inline bool CollisionOverlapCheck();
+	inline bool CollisionOverlapCheck() const;
+
+	/**
+	 * Device specialized versions of the update functions above. TInputPolicy is one of the input policies
+	 * from TopDownInputPolicies.h, only that device is queried and no branching on CurrentInputType is done.
+	 */
+	template<typename TInputPolicy> void SelectInputRoutines();
+	template<typename TInputPolicy> void MoveTrackingImpl();
+	template<typename TInputPolicy> void UpdateCursorPositionImpl();
+	template<typename TInputPolicy> void PositionCheckImpl();
+	template<typename TInputPolicy> bool ProjectToGroundPlaneImpl(FVector2D& OutScreenPos, FVector& OutIntersection);
+
+	/** GetPointerPositionImpl - Screen position of the active device's pointer, the viewport center and false when it has none. */
+	template<typename TInputPolicy> bool GetPointerPositionImpl(FVector2D& OutScreenPos);
+
+	/**
+	 * DeprojectPointerImpl - ProjectToGroundPlaneImpl, but tells apart a pointer without position from a failed deprojection.
+	 * @param bOutGotPointerPos: Whether the device had a position, OutScreenPos is the viewport center otherwise.
+	 * @return false when the screen position could not be deprojected, OutIntersection is zero then and must not be used.
+	 */
+	template<typename TInputPolicy> bool DeprojectPointerImpl(FVector2D& OutScreenPos, FVector& OutIntersection, bool& bOutGotPointerPos);
+	template<typename TInputPolicy> void CursorDistFromCenterImpl(FVector2D CursorPos, FVector& Direction, float& Strenght);
+	template<typename TInputPolicy> void EdgeMoveImpl(const FVector2D& ScreenPos, FVector& Direction, float& Strenght);
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	TObjectPtr<USceneComponent> Root;
@@ -188,20 +456,36 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	TObjectPtr<UFloatingPawnMovement> MovementComponent;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	TObjectPtr<UTopDownOcclusionComponent> OcclusionComponent;
+
+	/** Input assets are soft referenced and streamed in BeginPlay, actions are bound once they are loaded. */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Input")
-	TObjectPtr<UInputDataSetup> InputActions;
+	TSoftObjectPtr<UInputDataSetup> InputActions;
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
-	TObjectPtr<UInputMappingContext> BaseInputMappingContext;
+	TSoftObjectPtr<UInputMappingContext> BaseInputMappingContext;
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
-	TObjectPtr<UInputMappingContext> DragMoveMappingContext;
+	TSoftObjectPtr<UInputMappingContext> DragMoveMappingContext;
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
-	TObjectPtr<UInputMappingContext> SelectMappingContext;
+	TSoftObjectPtr<UInputMappingContext> SelectMappingContext;
+
+	/** Added next to the base context on builds with touch input, optional. Never loaded when TOPDOWN_WITH_TOUCH is 0. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
+	TSoftObjectPtr<UInputMappingContext> TouchMappingContext;
+
+	/** Added next to the base context on builds with gamepad input, optional. Never loaded when TOPDOWN_WITH_GAMEPAD is 0. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
+	TSoftObjectPtr<UInputMappingContext> GamepadMappingContext;
+
+	/** Pointer and viewport provider, a UTopDownControllerInputSource is created in BeginPlay when left empty. */
+	UPROPERTY(EditAnywhere, Instanced, BlueprintReadOnly, Category = "Input")
+	TObjectPtr<UTopDownInputSource> InputSource;
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Defaults")
-	TObjectPtr<UCurveFloat> ZoomCurve;
+	TSoftObjectPtr<UCurveFloat> ZoomCurve;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Defaults")
 	float ZoomSpeed;
@@ -214,15 +498,216 @@ protected:
 	
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Defaults")
 	TObjectPtr<AActor> HoverActor;
+
+	/**
+	 * Registers the pawn as a world partition streaming source so cells load around (and ahead of) the camera.
+	 * Only the pawns of players are registered, on their owning client and on the server.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Streaming")
+	bool bEnableStreamingSource;
+
+	/** How far ahead (in seconds) the streaming source is extrapolated from the smoothed velocity of the view center. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming", meta = (ClampMin = "0.0"))
+	float StreamingPredictionTime;
+
+	/** Multiplier applied to the ground footprint radius when building the streaming shapes. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming", meta = (ClampMin = "0.0"))
+	float StreamingRadiusScale;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming")
+	EStreamingSourcePriority StreamingSourcePriority;
+
+	/** Virtual cursor speed in pixels per second at full stick deflection. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gamepad", meta = (ClampMin = "0.0"))
+	float VirtualCursorSpeed;
+
+	/** Maps stick deflection (0-1) to a speed multiplier. When unset or not loaded yet, deflection is squared for finer control near the center. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Gamepad")
+	TSoftObjectPtr<UCurveFloat> VirtualCursorAccelerationCurve;
+
+	/** Seconds of continuous stick input to go from VirtualCursorInitialSpeedScale to full speed. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gamepad", meta = (ClampMin = "0.0"))
+	float VirtualCursorRampTime;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gamepad", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float VirtualCursorInitialSpeedScale;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gamepad")
+	bool bEnableAimAssist;
+
+	/** Screen space radius in pixels in which the virtual cursor snaps to selectables. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gamepad", meta = (ClampMin = "0.0"))
+	float VirtualCursorSnapRadius;
+
+	/** Speed the cursor is pulled onto the snap target once the stick is released. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gamepad", meta = (ClampMin = "0.0"))
+	float VirtualCursorSnapSpeed;
+
+	/** Speed multiplier while moving over the snap target, makes it easier to stop on it. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gamepad", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float VirtualCursorSnapFriction;
+
+	/** Time budget of a single snap query in milliseconds. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gamepad", meta = (ClampMin = "0.0"))
+	float VirtualCursorSnapBudgetMs;
+
+	/** How fast the camera catches up with the followed group, see StartGroupFollow. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Follow", meta = (ClampMin = "0.0"))
+	float GroupFollowSpeed;
+
+	/** Fraction of the ground footprint the bounds of the followed group may span, measured from the view center. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Follow", meta = (ClampMin = "0.05", ClampMax = "1.0"))
+	float GroupFollowFill;
+
+	/** Maximum ZoomValue change per second while fitting the group. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Follow", meta = (ClampMin = "0.0"))
+	float GroupFollowZoomSpeed;
+
+	/** Relative size difference tolerated before the zoom is adjusted, avoids constant zoom jitter. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Follow", meta = (ClampMin = "0.0"))
+	float GroupFollowZoomTolerance;
+
+	/** Seconds between camera interest updates sent to the server, which drive the network relevancy of UTopDownRelevancySubsystem. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network", meta = (ClampMin = "0.0"))
+	float CameraInterestInterval;
+
+	/** Distance the footprint bounds have to move before a new camera interest is sent. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network", meta = (ClampMin = "0.0"))
+	float CameraInterestTolerance;
+
+	/** Timestamps input samples and records when they move the camera, see GetInputLatencyPercentiles. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug")
+	bool bRecordInputLatency;
 private:
 	float ZoomDirection;
 	float ZoomValue;
 
 	EInputType CurrentInputType;
-	FTimerHandle MoveTrackingTimerHandle;
+
+	bool bDragMovePending;
+
+	/** A simulated Select started away from any selectable, and drags until it completes */
+	bool bSimulatedDragActive;
+
+	FTopDownLatencyTracker InputLatency;
+
+	/** A Move or edge scroll sample waits for the movement component to move the root */
+	bool bInputMovePending;
+
+	/** Set while the root is moved by something other than the movement component, so the move does not consume a latency sample */
+	bool bApplyingNonInputMove;
+
+	bool bWasEdgeScrolling;
+
+	/** Re-captured by GetViewProjection whenever the camera view changed, the location is the projection's view origin */
+	FTopDownViewProjection ViewProjection;
+	FRotator ViewProjectionRotation;
+	float ViewProjectionFieldOfView;
+
+	/** Reused by the Blueprint batch projection functions to avoid per call allocations */
+	FTopDownWorldPoints ScratchWorldPoints;
+	FTopDownScreenPoints ScratchScreenPoints;
+
+	/** Update routines specialized for the active input device, selected once in HandleInputTypeSwitched */
+	struct FInputRoutines
+	{
+		void (ATopDownPlayer::*MoveTracking)() = nullptr;
+		void (ATopDownPlayer::*UpdateCursorPosition)() = nullptr;
+		void (ATopDownPlayer::*PositionCheck)() = nullptr;
+		bool (ATopDownPlayer::*ProjectToGroundPlane)(FVector2D&, FVector&) = nullptr;
+		bool (ATopDownPlayer::*GetPointerPosition)(FVector2D&) = nullptr;
+		void (ATopDownPlayer::*CursorDistFromCenter)(FVector2D, FVector&, float&) = nullptr;
+	};
+
+	FInputRoutines InputRoutines;
 
 	TObjectPtr<APlayerController> PlayerController;
 
+	TObjectPtr<UTopDownSignificanceSubsystem> SignificanceSubsystem;
+
+	TObjectPtr<UTopDownSelectionSubsystem> SelectionSubsystem;
+
+	FVector2D VirtualCursorPosition;
+	FVector2D VirtualCursorInput;
+	float VirtualCursorHoldTime;
+	TWeakObjectPtr<AActor> VirtualCursorSnapTarget;
+
+	FTopDownGroundFootprint GroundFootprint;
+
+	void UpdateGroupFollow(float DeltaSeconds);
+	void OnFollowedUnitMoved(AActor* Unit, const FVector& OldLocation, const FVector& NewLocation);
+	void OnFollowedUnitUnregistered(AActor* Unit);
+
+	FTopDownGroupTracker FollowedGroup;
+	bool bFollowingGroup;
+	/** Per unit move listeners registered with the selection subsystem */
+	TMap<TObjectKey<AActor>, FDelegateHandle> FollowedUnitMovedHandles;
+	FDelegateHandle FollowedUnitUnregisteredHandle;
+
+	/** LoadAssets - Streams the zoom curve through the asset manager, every instance of the pawn needs it. */
+	void LoadAssets();
+	void OnAssetsLoaded();
+
+	/** SetupPlayerController - Caches the possessing player controller, called on BeginPlay and whenever the controller changes. */
+	void SetupPlayerController();
+
+	/**
+	 * LoadInputAssets - Streams the input data and mapping contexts, then the input actions, through the asset manager.
+	 * Only requested once a local player possesses the pawn, and assets for devices compiled out of the build are skipped.
+	 */
+	void LoadInputAssets();
+	void OnInputDataLoaded();
+	void OnInputAssetsLoaded();
+
+	void AddMappingContexts();
+	void RemoveMappingContexts();
+
+	/** Registers or unregisters the streaming source provider, called whenever the controller changes. */
+	void UpdateStreamingSourceRegistration();
+
+	/** Tracks the view center every tick, the pawn is mostly moved by offsets the movement component velocity does not see. */
+	void UpdateStreamingViewVelocity(float DeltaSeconds);
+
+	bool bStreamingSourceRegistered;
+	FVector StreamingViewCenter;
+	FVector StreamingViewVelocity;
+	bool bStreamingViewCenterFromFootprint;
+	bool bHasStreamingViewCenter;
+	void BindInputActions(UEnhancedInputComponent* EnhancedInputComponent);
+
+	/** UpdateCameraInterest - Sends the footprint to the server when it moved past CameraInterestTolerance, at most every CameraInterestInterval. */
+	void UpdateCameraInterest();
+
+	/** The view dependent updates would be a frame late in Tick, the movement component only moves the pawn afterwards */
+	FTopDownPostMovementTickFunction PostMovementTickFunction;
+
+	FTopDownCameraInterest SentCameraInterest;
+	double LastCameraInterestTime;
+	bool bCameraInterestSent;
+
+	/** Controller the server stored the camera interest for, removed again on unpossession and in EndPlay */
+	TWeakObjectPtr<AActor> CameraInterestViewer;
+
+	/** RemoveCameraInterestViewer - Removes the stored viewer from UTopDownRelevancySubsystem. */
+	void RemoveCameraInterestViewer();
+
+	TSharedPtr<FStreamableHandle> AssetsHandle;
+	TSharedPtr<FStreamableHandle> InputAssetsHandle;
+	TSharedPtr<FStreamableHandle> InputActionsHandle;
+
+	/** Input component received before the input actions were loaded, bound in OnInputAssetsLoaded */
+	TWeakObjectPtr<UEnhancedInputComponent> PendingInputComponent;
+
+	bool bInputAssetsRequested;
+	bool bInputAssetsLoaded;
+	double AssetsLoadStartTime;
+
+	/** Camera view the footprint was deprojected from */
+	FVector FootprintViewLocation;
+	FRotator FootprintViewRotation;
+	float FootprintFieldOfView;
+	FIntPoint FootprintViewportSize;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Defaults", meta = (AllowPrivateAccess = "true"))
 	FVector TargetHandle;
 };
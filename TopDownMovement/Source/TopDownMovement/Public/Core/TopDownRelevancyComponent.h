@@ -0,0 +1,35 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "TopDownRelevancyComponent.generated.h"
+
+/**
+ * Registers the replicated owning actor with UTopDownRelevancySubsystem on the server while it is in play
+ * and reports its moves, so the relevancy grid stays up to date without polling.
+ *
+ * The component alone does not change relevancy: the owner's IsNetRelevantFor has to forward to
+ * UTopDownRelevancySubsystem::IsActorNetRelevantFor. Derive from ATopDownRelevantActor, which does it and already
+ * has this component, or add the override shown in UTopDownRelevancySubsystem to pawn and character classes.
+ */
+UCLASS(ClassGroup = (TopDown), meta = (BlueprintSpawnableComponent))
+class TOPDOWNMOVEMENT_API UTopDownRelevancyComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UTopDownRelevancyComponent();
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+	void OnOwnerTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	FDelegateHandle TransformUpdatedHandle;
+
+	bool bRegistered;
+};
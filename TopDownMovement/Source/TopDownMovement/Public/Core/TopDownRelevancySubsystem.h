@@ -0,0 +1,126 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/NetSerialization.h"
+#include "UObject/ObjectKey.h"
+#include "Core/TopDownSpatialGrid.h"
+#include "TopDownRelevancySubsystem.generated.h"
+
+/** Camera focus and visible ground bounds of a top-down player, sent to the server to drive network relevancy. */
+USTRUCT(BlueprintType)
+struct TOPDOWNMOVEMENT_API FTopDownCameraInterest
+{
+	GENERATED_BODY()
+
+	/** Center of the visible ground area */
+	UPROPERTY(BlueprintReadOnly, Category = "Relevancy")
+	FVector_NetQuantize Focus = FVector::ZeroVector;
+
+	/** 2D bounds of the ground footprint, Z is unused */
+	UPROPERTY(BlueprintReadOnly, Category = "Relevancy")
+	FVector_NetQuantize BoundsMin = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Relevancy")
+	FVector_NetQuantize BoundsMax = FVector::ZeroVector;
+
+	FBox2D GetBounds() const { return FBox2D(FVector2D(BoundsMin), FVector2D(BoundsMax)); }
+
+	/** @return true if every bound moved less than Tolerance on the ground plane. */
+	bool Equals(const FTopDownCameraInterest& Other, float Tolerance) const;
+};
+
+/**
+ * Server side network relevancy from the camera of each top-down player instead of the pawn location.
+ *
+ * Replicated actors are kept in a spatial grid updated from their move notifications, usually through
+ * UTopDownRelevancyComponent. Each viewer's interest is reduced to the rectangle of cells overlapping its ground
+ * footprint expanded by RelevancyMargin, so a relevancy check is two hash lookups and a rectangle test.
+ * Actors in the cells entering a viewer's rectangle are force net updated, so they show up without waiting
+ * for their next scheduled update.
+ *
+ * The engine only asks the actor, so nothing changes until the actor's IsNetRelevantFor forwards here.
+ * ATopDownRelevantActor does that for plain actors, pawns and characters need the same override:
+ *
+ *	bool AMyUnit::IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const
+ *	{
+ *		bool bHandled;
+ *		const bool bRelevant = UTopDownRelevancySubsystem::IsActorNetRelevantFor(this, RealViewer, ViewTarget, bHandled);
+ *		return bHandled ? bRelevant : Super::IsNetRelevantFor(RealViewer, ViewTarget, SrcLocation);
+ *	}
+ */
+UCLASS()
+class TOPDOWNMOVEMENT_API UTopDownRelevancySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UTopDownRelevancySubsystem();
+
+	virtual void Deinitialize() override;
+
+	/**
+	 * IsActorNetRelevantFor - Camera interest relevancy of Actor for the connection of RealViewer.
+	 * Always, owner, view target and hidden actor relevancy are kept like the engine default.
+	 * bOutHandled is false when the actor is not registered or the viewer has not sent an interest yet,
+	 * the caller should then fall back to the default distance based relevancy.
+	 */
+	static bool IsActorNetRelevantFor(const AActor* Actor, const AActor* RealViewer, const AActor* ViewTarget, bool& bOutHandled);
+
+	UFUNCTION(BlueprintCallable, Category = "Relevancy")
+	void RegisterActor(AActor* Actor);
+
+	UFUNCTION(BlueprintCallable, Category = "Relevancy")
+	void UnregisterActor(AActor* Actor);
+
+	/** Refreshes the grid location of the actor, call whenever it moves. */
+	UFUNCTION(BlueprintCallable, Category = "Relevancy")
+	void NotifyActorMoved(AActor* Actor);
+
+	UFUNCTION(BlueprintPure, Category = "Relevancy")
+	int32 GetNumActors() const { return ActorGrid.Num(); }
+
+	/** Size of the grid cells interests are rounded out to. */
+	float GetCellSize() const { return ActorGrid.GetCellSize(); }
+
+	/** Stores the interest of a viewer (its player controller). Interests larger than MaxInterestExtent are clamped around the focus. */
+	void SetViewerInterest(const AActor* Viewer, const FTopDownCameraInterest& Interest);
+
+	void RemoveViewer(const AActor* Viewer);
+
+	bool GetViewerInterest(const AActor* Viewer, FTopDownCameraInterest& OutInterest) const;
+
+	/** @return the number of registered actors relevant to the viewer, or INDEX_NONE if it has no interest. */
+	int32 GetNumRelevantActors(const AActor* Viewer) const;
+
+	/** Distance kept relevant around the footprint, so units are replicated before they scroll into view. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Relevancy", meta = (ClampMin = "0.0"))
+	float RelevancyMargin;
+
+	/** Largest footprint extent accepted from a client, limits the cost and what a modified client can request. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Relevancy", meta = (ClampMin = "0.0"))
+	float MaxInterestExtent;
+
+private:
+	struct FViewer
+	{
+		FTopDownCameraInterest Interest;
+
+		/** Relevant cells, Max is exclusive */
+		FIntRect Cells;
+	};
+
+	bool IsRelevantFor(const AActor* Actor, const AActor* RealViewer, bool& bOutHandled) const;
+
+	/** Force net updates the actors in the cells of NewCells that are not in OldCells. */
+	void ForceNetUpdateEnteredCells(const FIntRect& NewCells, const FIntRect* OldCells) const;
+
+	TTopDownSpatialGrid<TWeakObjectPtr<AActor>> ActorGrid;
+
+	/** Last location reported through NotifyActorMoved, to skip moves that stay in place */
+	TMap<TWeakObjectPtr<AActor>, FVector> ActorLocations;
+
+	TMap<TObjectKey<AActor>, FViewer> Viewers;
+};
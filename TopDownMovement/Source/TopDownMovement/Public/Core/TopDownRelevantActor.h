@@ -0,0 +1,35 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "TopDownRelevantActor.generated.h"
+
+class USceneComponent;
+class UTopDownRelevancyComponent;
+
+/**
+ * Replicated actor whose network relevancy follows the camera interest of each top-down player.
+ * Has a UTopDownRelevancyComponent and forwards IsNetRelevantFor to UTopDownRelevancySubsystem::IsActorNetRelevantFor,
+ * falling back to the engine default while the actor or the viewer is unknown to the subsystem.
+ */
+UCLASS(Blueprintable)
+class TOPDOWNMOVEMENT_API ATopDownRelevantActor : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	ATopDownRelevantActor();
+
+	virtual bool IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const override;
+
+	UTopDownRelevancyComponent* GetRelevancyComponent() const { return RelevancyComponent; }
+
+protected:
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+	TObjectPtr<USceneComponent> Root;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+	TObjectPtr<UTopDownRelevancyComponent> RelevancyComponent;
+};
@@ -0,0 +1,29 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "TopDownSelectableComponent.generated.h"
+
+/**
+ * Registers the owning actor with UTopDownSelectionSubsystem while it is in play
+ * and reports its moves, so the selection index stays up to date without polling.
+ */
+UCLASS(ClassGroup = (TopDown), meta = (BlueprintSpawnableComponent))
+class TOPDOWNMOVEMENT_API UTopDownSelectableComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UTopDownSelectableComponent();
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+	void OnOwnerTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	FDelegateHandle TransformUpdatedHandle;
+};
@@ -0,0 +1,99 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Core/TopDownSpatialGrid.h"
+#include "UObject/ObjectKey.h"
+#include "TopDownSelectionSubsystem.generated.h"
+
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnSelectableMovedSignature, AActor* /*Actor*/, const FVector& /*OldLocation*/, const FVector& /*NewLocation*/);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnSelectableUnregisteredSignature, AActor* /*Actor*/);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnSelectionChangedSignature);
+
+/**
+ * Keeps every selectable actor in a spatial grid so cursor snapping and area queries
+ * never need physics overlaps. Selectables are usually registered through UTopDownSelectableComponent.
+ *
+ * Also holds the current selection set, filled by the project's HandleSelection logic.
+ */
+UCLASS()
+class TOPDOWNMOVEMENT_API UTopDownSelectionSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UTopDownSelectionSubsystem();
+
+	virtual void Deinitialize() override;
+
+	/** Broadcast from NotifySelectableMoved, only for selectables that actually moved. Fires for every selectable in the world. */
+	FOnSelectableMovedSignature OnSelectableMoved;
+
+	/**
+	 * AddSelectableMovedListener - Same as OnSelectableMoved but only for the given selectable, so following a few units
+	 * costs nothing when the rest of the world moves. Listeners are dropped when the selectable is unregistered.
+	 */
+	FDelegateHandle AddSelectableMovedListener(const AActor* Actor, FOnSelectableMovedSignature::FDelegate&& Delegate);
+	void RemoveSelectableMovedListener(const AActor* Actor, FDelegateHandle Handle);
+
+	FOnSelectableUnregisteredSignature OnSelectableUnregistered;
+
+	UPROPERTY(BlueprintAssignable, Category = "Selection")
+	FOnSelectionChangedSignature OnSelectionChanged;
+
+	UFUNCTION(BlueprintCallable, Category = "Selection")
+	void SetSelection(const TArray<AActor*>& Actors);
+
+	UFUNCTION(BlueprintCallable, Category = "Selection")
+	void AddToSelection(AActor* Actor);
+
+	UFUNCTION(BlueprintCallable, Category = "Selection")
+	void RemoveFromSelection(AActor* Actor);
+
+	UFUNCTION(BlueprintCallable, Category = "Selection")
+	void ClearSelection();
+
+	const TArray<TObjectPtr<AActor>>& GetSelection() const { return Selection; }
+
+	UFUNCTION(BlueprintPure, Category = "Selection", meta = (DisplayName = "Get Selection"))
+	TArray<AActor*> K2_GetSelection() const { return TArray<AActor*>(Selection); }
+
+	UFUNCTION(BlueprintCallable, Category = "Selection")
+	void RegisterSelectable(AActor* Actor);
+
+	UFUNCTION(BlueprintCallable, Category = "Selection")
+	void UnregisterSelectable(AActor* Actor);
+
+	/** Refreshes the grid location of the selectable, call whenever it moves. */
+	UFUNCTION(BlueprintCallable, Category = "Selection")
+	void NotifySelectableMoved(AActor* Actor);
+
+	UFUNCTION(BlueprintPure, Category = "Selection")
+	bool IsSelectable(const AActor* Actor) const { return SelectableGrid.Contains(const_cast<AActor*>(Actor)); }
+
+	UFUNCTION(BlueprintPure, Category = "Selection")
+	int32 GetNumSelectables() const { return SelectableGrid.Num(); }
+
+	const TTopDownSpatialGrid<TWeakObjectPtr<AActor>>& GetSelectableGrid() const { return SelectableGrid; }
+
+	/** Last location reported through NotifySelectableMoved, without querying the actor. */
+	bool GetSelectableLocation(const AActor* Actor, FVector& OutLocation) const;
+
+	/** Selectables within Radius of Location on the ground plane. */
+	UFUNCTION(BlueprintCallable, Category = "Selection")
+	void FindSelectablesInRadius(const FVector& Location, float Radius, TArray<AActor*>& OutActors) const;
+
+private:
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<AActor>> Selection;
+
+	TTopDownSpatialGrid<TWeakObjectPtr<AActor>> SelectableGrid;
+
+	/** Last known location of every selectable, used to report the previous location on moves */
+	TMap<TWeakObjectPtr<AActor>, FVector> SelectableLocations;
+
+	/** Per selectable move listeners, only selectables someone listens to have an entry */
+	TMap<TObjectKey<AActor>, FOnSelectableMovedSignature> SelectableMovedListeners;
+};
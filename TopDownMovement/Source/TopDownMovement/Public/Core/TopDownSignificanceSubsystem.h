@@ -0,0 +1,168 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Components/SceneComponent.h"
+#include "Core/TopDownSpatialGrid.h"
+#include "TopDownSignificanceSubsystem.generated.h"
+
+USTRUCT(BlueprintType)
+struct TOPDOWNMOVEMENT_API FTopDownCameraFocus
+{
+	GENERATED_BODY()
+
+	/** Center of the visible ground area */
+	UPROPERTY(BlueprintReadOnly, Category = "Significance")
+	FVector ViewCenter = FVector::ZeroVector;
+
+	/** Ground location under the cursor (CollisionSphere location) */
+	UPROPERTY(BlueprintReadOnly, Category = "Significance")
+	FVector CursorLocation = FVector::ZeroVector;
+
+	/** Last interaction location captured by the player (TargetHandle) */
+	UPROPERTY(BlueprintReadOnly, Category = "Significance")
+	FVector TargetHandle = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Significance")
+	float FootprintRadius = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Significance")
+	float ZoomValue = 0.0f;
+};
+
+USTRUCT(BlueprintType)
+struct TOPDOWNMOVEMENT_API FTopDownSignificanceTier
+{
+	GENERATED_BODY()
+
+	/** Outer edge of the tier, expressed as a multiple of the ground footprint radius */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance", meta = (ClampMin = "0.0"))
+	float FootprintRadiusScale = 1.0f;
+
+	/** Actor tick interval applied while in this tier; 0 ticks every frame */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance", meta = (ClampMin = "0.0"))
+	float TickInterval = 0.0f;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCameraFocusPublishedSignature, const FTopDownCameraFocus&, CameraFocus);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnSignificanceTierChangedSignature, AActor*, Actor, int32, NewTier);
+
+/**
+ * Publishes the camera focus of the local top-down player and throttles the tick rate of registered actors
+ * depending on how far they are from the visible ground area.
+ *
+ * Actors are bucketed in a grid of 2000 unit cells, kept up to date from their root's transform updates.
+ * When the focus moves, a cell that lies entirely within one ring is re-tiered as a whole, and only when its ring changed.
+ * Actors are evaluated one by one only in cells crossing a ring boundary (or its hysteresis band), and when they move.
+ */
+UCLASS()
+class TOPDOWNMOVEMENT_API UTopDownSignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UTopDownSignificanceSubsystem();
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	UPROPERTY(BlueprintAssignable, Category = "Significance")
+	FOnCameraFocusPublishedSignature OnCameraFocusPublished;
+
+	UPROPERTY(BlueprintAssignable, Category = "Significance")
+	FOnSignificanceTierChangedSignature OnSignificanceTierChanged;
+
+	/** Called by the player each update with the current camera focus. */
+	UFUNCTION(BlueprintCallable, Category = "Significance")
+	void PublishCameraFocus(const FTopDownCameraFocus& NewCameraFocus);
+
+	UFUNCTION(BlueprintPure, Category = "Significance")
+	const FTopDownCameraFocus& GetCameraFocus() const { return CameraFocus; }
+
+	/**
+	 * Tiers must be sorted from the closest to the furthest. Actors outside the last tier use the last tier's interval.
+	 * Changing tiers re-evaluates all registered actors on the next update.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Significance")
+	void SetSignificanceTiers(const TArray<FTopDownSignificanceTier>& NewTiers);
+
+	UFUNCTION(BlueprintCallable, Category = "Significance")
+	void RegisterActor(AActor* Actor);
+
+	/** Restores the tick interval the actor had when it was registered. */
+	UFUNCTION(BlueprintCallable, Category = "Significance")
+	void UnregisterActor(AActor* Actor);
+
+	/** @return the current tier of the actor, or INDEX_NONE if it is not registered. */
+	UFUNCTION(BlueprintPure, Category = "Significance")
+	int32 GetActorTier(const AActor* Actor) const;
+
+	/** @return the number of registered actors in the given tier. */
+	UFUNCTION(BlueprintPure, Category = "Significance")
+	int32 GetTierPopulation(int32 Tier) const;
+
+	/** Fraction of a tier's distance an actor has to move past the boundary before it is demoted, avoids flapping. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance", meta = (ClampMin = "0.0"))
+	float TierHysteresis;
+
+private:
+	struct FRegisteredActor
+	{
+		TWeakObjectPtr<AActor> Actor;
+		TObjectKey<AActor> Key;
+		TWeakObjectPtr<USceneComponent> Root;
+		FDelegateHandle MovedHandle;
+		int32 Tier = INDEX_NONE;
+		float OriginalTickInterval = 0.0f;
+		bool bMoved = false;
+	};
+
+	int32 ComputeTier(const FVector& Location, int32 CurrentTier) const;
+
+	/** @return the tier every actor of the cell has whatever its previous tier, or INDEX_NONE when the cell crosses a ring or a hysteresis band. */
+	int32 ComputeCellTier(const FIntPoint& Cell) const;
+
+	/** Re-tiers the cells whose ring changed since the focus last moved. */
+	void UpdateCells();
+
+	/** Re-tiers the actors that moved since the last update. */
+	void UpdateMovedActors();
+
+	/** Sets the tier of one actor, CellTier if the cell lies within one ring or from its own distance otherwise. @return false when the actor is gone. */
+	bool EvaluateActor(int32 Index, int32 CellTier);
+
+	void ApplyTier(FRegisteredActor& Entry, int32 NewTier);
+	void RemoveAtSwap(int32 Index);
+
+	void OnActorMoved(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport, TObjectKey<AActor> Key);
+
+	UFUNCTION()
+	void OnActorDestroyed(AActor* DestroyedActor);
+
+	FTopDownCameraFocus CameraFocus;
+
+	TArray<FTopDownSignificanceTier> Tiers;
+
+	/** Squared outer distance of each tier, cached whenever the focus or tiers change */
+	TArray<float> TierDistancesSquared;
+
+	TArray<int32> TierPopulation;
+
+	TArray<FRegisteredActor> RegisteredActors;
+	TMap<TObjectKey<AActor>, int32> ActorIndices;
+
+	TTopDownSpatialGrid<TObjectKey<AActor>> ActorGrid;
+
+	/** Ring each cell was last re-tiered to as a whole, INDEX_NONE for cells evaluated per actor */
+	TMap<FIntPoint, int32> CellTiers;
+
+	/** Actors whose root moved since the last update */
+	TArray<TObjectKey<AActor>> MovedActors;
+
+	/** The focus or the tiers changed since the cells were last updated */
+	bool bCellsDirty;
+};
@@ -0,0 +1,188 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * TTopDownSpatialGrid - Uniform 2D hash grid on the ground plane (XY only).
+ * Elements are only moved between cells when they cross a cell border, so updates are O(1) for most moves
+ * and queries only visit the cells overlapping the query area. Each element knows its index in its cell,
+ * and cells are kept once created, so neither updates nor removals search or reallocate.
+ *
+ * ElementType needs GetTypeHash and operator==.
+ */
+template<typename ElementType>
+class TTopDownSpatialGrid
+{
+public:
+	struct FEntry
+	{
+		ElementType Element;
+		FVector Location;
+	};
+
+	explicit TTopDownSpatialGrid(float InCellSize = 1000.0f)
+		: CellSize(FMath::Max(InCellSize, 1.0f))
+		, InvCellSize(1.0f / CellSize)
+	{
+	}
+
+	float GetCellSize() const { return CellSize; }
+
+	int32 Num() const { return ElementCells.Num(); }
+
+	bool Contains(const ElementType& Element) const { return ElementCells.Contains(Element); }
+
+	FIntPoint GetCell(const FVector& Location) const
+	{
+		return FIntPoint(FMath::FloorToInt32(Location.X * InvCellSize), FMath::FloorToInt32(Location.Y * InvCellSize));
+	}
+
+	/** Adds the element, or moves it if it is already in the grid. */
+	void Add(const ElementType& Element, const FVector& Location)
+	{
+		if (ElementCells.Contains(Element))
+		{
+			Update(Element, Location);
+			return;
+		}
+
+		const FIntPoint Cell = GetCell(Location);
+		ElementCells.Add(Element, { Cell, AddToCell(Cell, Element, Location) });
+	}
+
+	/** @return the previous cell when the element changed cell, or its current cell otherwise. */
+	FIntPoint Update(const ElementType& Element, const FVector& Location)
+	{
+		FSlot* Slot = ElementCells.Find(Element);
+		if (!Slot)
+		{
+			Add(Element, Location);
+			return GetCell(Location);
+		}
+
+		const FIntPoint PreviousCell = Slot->Cell;
+		const FIntPoint NewCell = GetCell(Location);
+
+		if (NewCell == PreviousCell)
+		{
+			Cells.FindChecked(PreviousCell)[Slot->Index].Location = Location;
+			return PreviousCell;
+		}
+
+		RemoveFromCell(*Slot);
+
+		Slot->Cell = NewCell;
+		Slot->Index = AddToCell(NewCell, Element, Location);
+
+		return PreviousCell;
+	}
+
+	void Remove(const ElementType& Element)
+	{
+		FSlot Slot;
+		if (!ElementCells.RemoveAndCopyValue(Element, Slot)) return;
+
+		RemoveFromCell(Slot);
+	}
+
+	void Reset()
+	{
+		Cells.Reset();
+		ElementCells.Reset();
+	}
+
+	/** @return the cell the element was last added or updated in, or nullptr if it is not in the grid. */
+	const FIntPoint* FindElementCell(const ElementType& Element) const
+	{
+		const FSlot* Slot = ElementCells.Find(Element);
+		return Slot ? &Slot->Cell : nullptr;
+	}
+
+	/** @return the entries of a cell, or nullptr if nothing was ever added to it. Cells emptied since are kept and return an empty array. */
+	const TArray<FEntry>* FindCell(const FIntPoint& Cell) const
+	{
+		return Cells.Find(Cell);
+	}
+
+	/** Visits every cell that holds or once held entries, with its possibly empty entries. The grid must not be modified meanwhile. */
+	template<typename VisitorType>
+	void ForEachCell(VisitorType&& Visitor) const
+	{
+		for (const TPair<FIntPoint, TArray<FEntry>>& Pair : Cells)
+		{
+			Visitor(Pair.Key, Pair.Value);
+		}
+	}
+
+	/**
+	 * Visits every entry in the cells overlapping the box. The visitor returns false to stop the query.
+	 * Entries are not filtered against the box itself, only their cells are.
+	 */
+	template<typename VisitorType>
+	void ForEachInBox(const FBox2D& Box, VisitorType&& Visitor) const
+	{
+		const FIntPoint MinCell = GetCell(FVector(Box.Min, 0.0f));
+		const FIntPoint MaxCell = GetCell(FVector(Box.Max, 0.0f));
+
+		for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+		{
+			for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+			{
+				if (const TArray<FEntry>* Entries = Cells.Find(FIntPoint(CellX, CellY)))
+				{
+					for (const FEntry& Entry : *Entries)
+					{
+						if (!Visitor(Entry)) return;
+					}
+				}
+			}
+		}
+	}
+
+	/** Visits every entry within Radius of Center (XY only). The visitor returns false to stop the query. */
+	template<typename VisitorType>
+	void ForEachInRadius(const FVector2D& Center, float Radius, VisitorType&& Visitor) const
+	{
+		const float RadiusSquared = FMath::Square(Radius);
+		ForEachInBox(FBox2D(Center - FVector2D(Radius), Center + FVector2D(Radius)), [&](const FEntry& Entry)
+		{
+			if (FVector2D::DistSquared(FVector2D(Entry.Location), Center) > RadiusSquared) return true;
+			return Visitor(Entry);
+		});
+	}
+
+private:
+	/** Where an element lives, Index is its position in the entries of Cell */
+	struct FSlot
+	{
+		FIntPoint Cell;
+		int32 Index;
+	};
+
+	int32 AddToCell(const FIntPoint& Cell, const ElementType& Element, const FVector& Location)
+	{
+		return Cells.FindOrAdd(Cell).Add({ Element, Location });
+	}
+
+	/** Swaps the last entry of the cell into the removed one's place and fixes up that entry's index. */
+	void RemoveFromCell(const FSlot& Slot)
+	{
+		TArray<FEntry>& Entries = Cells.FindChecked(Slot.Cell);
+		check(Entries.IsValidIndex(Slot.Index));
+
+		Entries.RemoveAtSwap(Slot.Index, 1, EAllowShrinking::No);
+		if (Slot.Index < Entries.Num())
+		{
+			ElementCells.FindChecked(Entries[Slot.Index].Element).Index = Slot.Index;
+		}
+	}
+
+	float CellSize;
+	float InvCellSize;
+
+	/** Emptied cells are kept, elements going back and forth over a border would otherwise reallocate them */
+	TMap<FIntPoint, TArray<FEntry>> Cells;
+	TMap<ElementType, FSlot> ElementCells;
+};
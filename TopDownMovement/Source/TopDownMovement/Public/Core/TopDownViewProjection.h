@@ -0,0 +1,88 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FMinimalViewInfo;
+
+/**
+ * Structure of arrays block of world positions, all arrays have the same length.
+ * Positions are stored relative to Origin in single precision, pick an origin near the points (such as the view origin)
+ * so large world coordinates keep their precision.
+ */
+struct TOPDOWNMOVEMENT_API FTopDownWorldPoints
+{
+	TArray<float> X;
+	TArray<float> Y;
+	TArray<float> Z;
+
+	FVector Origin = FVector::ZeroVector;
+
+	int32 Num() const { return X.Num(); }
+
+	/** Empties the block and sets the origin the following positions are stored relative to. */
+	void Reset(int32 NewCapacity = 0, const FVector& NewOrigin = FVector::ZeroVector);
+	void Add(const FVector& Location);
+	void Set(int32 Index, const FVector& Location);
+};
+
+/** Structure of arrays block of screen positions in viewport pixels, filled by FTopDownViewProjection::ProjectPoints. */
+struct TOPDOWNMOVEMENT_API FTopDownScreenPoints
+{
+	TArray<float> X;
+	TArray<float> Y;
+
+	/** 1 when the point is in front of the camera and inside the viewport */
+	TArray<uint8> Visible;
+
+	int32 Num() const { return X.Num(); }
+};
+
+/**
+ * View-projection matrix of the top-down camera, used to map large numbers of world positions to the screen
+ * without going through APlayerController::ProjectWorldLocationToScreen per actor.
+ */
+struct TOPDOWNMOVEMENT_API FTopDownViewProjection
+{
+	FTopDownViewProjection();
+
+	/** Captures the view-projection matrix for the view and the viewport size in pixels. */
+	void Capture(const FMinimalViewInfo& ViewInfo, const FIntPoint& InViewportSize);
+
+	bool IsValid() const { return bIsValid; }
+
+	const FMatrix& GetViewProjectionMatrix() const { return ViewProjectionMatrix; }
+
+	const FIntPoint& GetViewportSize() const { return ViewportSize; }
+
+	/** Camera location of the captured view, a good FTopDownWorldPoints origin. */
+	const FVector& GetViewOrigin() const { return ViewOrigin; }
+
+	/** @return true if the location is in front of the camera and inside the viewport. */
+	bool ProjectWorldToScreen(const FVector& WorldLocation, FVector2D& OutScreenPosition) const;
+
+	/** Ray through the screen position in viewport pixels, same convention as APlayerController::DeprojectScreenPositionToWorld. */
+	bool DeprojectScreenToWorld(const FVector2D& ScreenPosition, FVector& OutWorldOrigin, FVector& OutWorldDirection) const;
+
+	/**
+	 * Projects every point of the block, four at a time using vector registers. Resizes OutScreenPoints as needed.
+	 * The matrix is rebased on the block's origin in double precision before it is converted to single precision.
+	 */
+	void ProjectPoints(const FTopDownWorldPoints& WorldPoints, FTopDownScreenPoints& OutScreenPoints) const;
+
+	/**
+	 * FindNearestToScreenPosition - Searches the visible screen points for the one closest to ScreenPosition.
+	 * @return the index of the nearest point within MaxDistance pixels, or INDEX_NONE.
+	 */
+	static int32 FindNearestToScreenPosition(const FTopDownScreenPoints& ScreenPoints, const FVector2D& ScreenPosition, float MaxDistance);
+
+private:
+	FMatrix ViewProjectionMatrix;
+	FMatrix InvViewProjectionMatrix;
+
+	FVector ViewOrigin;
+	FIntPoint ViewportSize;
+
+	bool bIsValid;
+};
@@ -3,6 +3,9 @@
 #pragma once
 
 #include "Modules/ModuleManager.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("TopDownMovement"), STATGROUP_TopDownMovement, STATCAT_Advanced);
 
 class FTopDownMovementModule : public IModuleInterface
 {
@@ -39,12 +39,23 @@ public class TopDownMovement : ModuleRules
 				"Slate",
 				"SlateCore",
 				"InputCore",
-				"EnhancedInput"
+				"EnhancedInput",
+				"Landscape"
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
 		
 		
+		// Input devices compiled in, see TopDownInputConfig.h. A target overrides any of them through its GlobalDefinitions,
+		// e.g. GlobalDefinitions.Add("TOPDOWN_WITH_GAMEPAD=0") in a desktop game's Target.cs.
+		// The others default to what the platform can use in Shipping, and to everything otherwise
+		bool bIsMobile = Target.Platform == UnrealTargetPlatform.Android || Target.Platform == UnrealTargetPlatform.IOS;
+		bool bStripUnusedInputDevices = Target.Configuration == UnrealTargetConfiguration.Shipping;
+
+		AddInputDeviceDefinition(Target, "TOPDOWN_WITH_MOUSE", !(bStripUnusedInputDevices && bIsMobile));
+		AddInputDeviceDefinition(Target, "TOPDOWN_WITH_TOUCH", !(bStripUnusedInputDevices && !bIsMobile));
+		AddInputDeviceDefinition(Target, "TOPDOWN_WITH_GAMEPAD", !(bStripUnusedInputDevices && bIsMobile));
+
 		DynamicallyLoadedModuleNames.AddRange(
 			new string[]
 			{
@@ -52,4 +63,18 @@ public class TopDownMovement : ModuleRules
 			}
 			);
 	}
+
+	/** Adds the platform default for an input device definition, unless the target already defines it globally. */
+	private void AddInputDeviceDefinition(ReadOnlyTargetRules Target, string Name, bool bDefaultEnabled)
+	{
+		foreach (string Definition in Target.GlobalDefinitions)
+		{
+			if (Definition == Name || Definition.StartsWith(Name + "="))
+			{
+				return;
+			}
+		}
+
+		PublicDefinitions.Add(Name + "=" + (bDefaultEnabled ? "1" : "0"));
+	}
 }